@@ -49,6 +49,7 @@ class Block {
 	public:
 		Block(string const& id) {
 			this->id = id;
+			this->numerical_id = -1;
 			this->layer = -1;
 			this->power_density= 0.0;
 			this->AR.min = AR.max = 1.0;
@@ -61,6 +62,9 @@ class Block {
 	// public data, functions
 	public:
 		string id;
+		// index of block (or pin) in related container; required to map
+		// blocks across different copies of the chip data
+		int numerical_id;
 		mutable int layer;
 
 		// flag to monitor placement; also required for alignment handling
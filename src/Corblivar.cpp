@@ -53,6 +53,9 @@ int main (int argc, char** argv) {
 	// init thermal analyzer, only reasonable after parsing config file
 	fp.initThermalAnalyzer();
 
+	// init thread pool, only reasonable after parsing config file
+	fp.initThreadPool();
+
 	// non-regular run; read in solution file
 	// (TODO) adapt if further optimization of read in data is desired
 	if (fp.inputSolutionFileOpen()) {
@@ -74,16 +77,27 @@ int main (int argc, char** argv) {
 	}
 	// regular run; perform floorplanning
 	else {
-		// generate new, random data set
-		corb.initCorblivarRandomly(fp.logMed(), fp.getLayers(), fp.getBlocks(), fp.powerAwareBlockHandling());
-
 		if (fp.logMin()) {
 			cout << "Corblivar> ";
-			cout << "Performing SA floorplanning optimization ..." << endl << endl;
+			if (fp.hierarchicalMode()) {
+				cout << "Performing hierarchical SA floorplanning optimization ..." << endl << endl;
+			}
+			else {
+				cout << "Performing SA floorplanning optimization ..." << endl << endl;
+			}
 		}
 
-		// perform SA; main handler
-		done = fp.performSA(corb);
+		// perform SA; main handler. For hierarchical floorplanning, the layout
+		// is directly memorized in the blocks
+		if (fp.hierarchicalMode()) {
+			done = fp.performHierarchicalSA(corb);
+		}
+		else {
+			// generate new data set
+			fp.initCorblivar(corb);
+
+			done = fp.performSA(corb);
+		}
 
 		if (fp.logMin()) {
 			cout << "Corblivar> ";
@@ -95,7 +109,17 @@ int main (int argc, char** argv) {
 			}
 		}
 
-		// finalize: generate output files, final logging
-		fp.finalize(corb);
+		// finalize: generate output files, final logging. For hierarchical
+		// floorplanning, there are no CBLs for the overall layout and the
+		// overall cost cannot be determined since the normalization differs
+		// across the clusters. Note that hierarchical floorplanning may have
+		// fallen back to flat floorplanning, which is then reflected by
+		// hierarchicalMode()
+		if (fp.hierarchicalMode()) {
+			fp.finalize(corb, false, false);
+		}
+		else {
+			fp.finalize(corb);
+		}
 	}
 }
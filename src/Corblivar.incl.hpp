@@ -31,9 +31,19 @@
 #include <array>
 #include <vector>
 #include <map>
+#include <set>
 #include <list>
+#include <queue>
 #include <utility>
 #include <algorithm>
+#include <functional>
+#include <memory>
+#include <limits>
+#include <random>
+// threading support
+#include <thread>
+#include <mutex>
+#include <condition_variable>
 // (TODO) replace w/ chrono
 #include <sys/timeb.h>
 
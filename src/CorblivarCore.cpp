@@ -30,7 +30,7 @@
 // memory allocation
 constexpr int CorblivarCore::SORT_CBLS_BY_BLOCKS_SIZE;
 
-void CorblivarCore::initCorblivarRandomly(bool const& log, int const& layers, vector<Block> const& blocks, bool const& power_aware_assignment) {
+void CorblivarCore::initCorblivarRandomly(bool const& log, int const& layers, vector<Block> const& blocks, bool const& power_aware_assignment, bool const& layers_assigned) {
 	Direction cur_dir;
 	int die, cur_t, cur_layer;
 	double blocks_area_per_layer, cur_blocks_area;
@@ -40,7 +40,10 @@ void CorblivarCore::initCorblivarRandomly(bool const& log, int const& layers, ve
 	if (log) {
 		cout << "Corblivar> ";
 		cout << "Initializing Corblivar data for corb on " << layers << " layers; ";
-		if (power_aware_assignment) {
+		if (layers_assigned) {
+			cout << "w/ given assignment of blocks to layers..." << endl;
+		}
+		else if (power_aware_assignment) {
 			cout << "w/ power-aware block handling..." << endl;
 		}
 		else {
@@ -52,7 +55,7 @@ void CorblivarCore::initCorblivarRandomly(bool const& log, int const& layers, ve
 	blocks_copy = blocks;
 
 	// prepare power-aware assignment
-	if (power_aware_assignment) {
+	if (power_aware_assignment && !layers_assigned) {
 
 		// init vars
 		blocks_area_per_layer = cur_blocks_area = 0.0;
@@ -81,9 +84,13 @@ void CorblivarCore::initCorblivarRandomly(bool const& log, int const& layers, ve
 		// determine related block from original blocks container
 		cur_block = Block::findBlock(cur_block_copy.id, blocks);
 
+		// consider given assignment
+		if (layers_assigned) {
+			die = cur_block->layer;
+		}
 		// for power-aware assignment, fill layers w/ (sorted) blocks until the
 		// dies are evenly occupied
-		if (power_aware_assignment) {
+		else if (power_aware_assignment) {
 
 			cur_blocks_area += cur_block->bb.area;
 
@@ -118,6 +125,267 @@ void CorblivarCore::initCorblivarRandomly(bool const& log, int const& layers, ve
 		this->dies[die].CBL.S.push_back(move(cur_block));
 		this->dies[die].CBL.L.push_back(move(cur_dir));
 		this->dies[die].CBL.T.push_back(move(cur_t));
+		this->dies[die].modifiedCBL();
+	}
+
+	if (CorblivarCore::DBG) {
+		for (CorblivarDie const& die : this->dies) {
+			cout << "DBG_CORE> ";
+			cout << "Init CBL tuples for die " << die.id + 1 << "; " << die.CBL.size() << " tuples:" << endl;
+			cout << die.CBL.CBLString() << endl;
+			cout << "DBG_CORE> ";
+			cout << endl;
+		}
+	}
+
+	if (log) {
+		cout << "Corblivar> ";
+		cout << "Done" << endl << endl;
+	}
+}
+
+// constructive initialization: blocks are assigned to dies such that the blocks' area is
+// balanced across dies (or power-aware, similar to the random initialization); the CBL
+// of each die is then build up greedily, i.e., for each block (sorted by decreasing
+// area) all possible tuples (L, T) are evaluated w/ the block placement as it would
+// result from the regular layout generation, and the tuple resulting in the smallest
+// die outline relative to the fixed outline is selected. The tuples are evaluated
+// incrementally, i.e., in O(n log n) for n blocks on the placement stacks, thus the
+// overall construction requires O(n^2 log n). The resulting layouts usually fit into or
+// are close to the outline.
+void CorblivarCore::initCorblivarConstructively(bool const& log, int const& layers, vector<Block> const& blocks, bool const& power_aware_assignment, Point const& die_outline, bool const& layers_assigned) {
+	vector<Block const*> blocks_sorted;
+	vector< vector<Block const*> > dies_blocks;
+	vector<double> dies_area;
+	double blocks_area_per_layer, cur_blocks_area;
+	double outline_x, outline_y;
+	double lower_front, upper_bound, first_coord, second_coord, trial_ur_x, trial_ur_y;
+	double cur_score, cur_score_tie, best_score, best_score_tie;
+	int die, cur_layer;
+	unsigned t, stack_size;
+	Direction best_dir;
+	unsigned best_t;
+
+	if (log) {
+		cout << "Corblivar> ";
+		cout << "Initializing Corblivar data constructively for corb on " << layers << " layers; ";
+		if (layers_assigned) {
+			cout << "w/ given assignment of blocks to layers..." << endl;
+		}
+		else if (power_aware_assignment) {
+			cout << "w/ power-aware block handling..." << endl;
+		}
+		else {
+			cout << "w/o power-aware block handling..." << endl;
+		}
+	}
+
+	for (Block const& b : blocks) {
+		blocks_sorted.push_back(&b);
+	}
+
+	dies_blocks.resize(layers);
+	dies_area.resize(layers, 0.0);
+
+	/// die assignment
+	//
+	// consider given assignment
+	if (layers_assigned) {
+
+		for (Block const* cur_block : blocks_sorted) {
+			dies_blocks[cur_block->layer].push_back(cur_block);
+			dies_area[cur_block->layer] += cur_block->bb.area;
+		}
+	}
+	// power-aware assignment: fill layers w/ blocks sorted by power density until the
+	// dies are evenly occupied; similar to random initialization
+	else if (power_aware_assignment) {
+
+		sort(blocks_sorted.begin(), blocks_sorted.end(),
+			// lambda expression
+			[&](Block const* b1, Block const* b2) {
+				return b1->power_density < b2->power_density;
+			}
+		    );
+
+		blocks_area_per_layer = 0.0;
+		for (Block const& cur_block : blocks) {
+			blocks_area_per_layer += cur_block.bb.area;
+		}
+		blocks_area_per_layer /= layers;
+
+		cur_blocks_area = 0.0;
+		cur_layer = 0;
+
+		for (Block const* cur_block : blocks_sorted) {
+
+			cur_blocks_area += cur_block->bb.area;
+
+			if (cur_blocks_area > blocks_area_per_layer) {
+				cur_layer++;
+				cur_blocks_area = 0.0;
+			}
+
+			// sanity check to limit die
+			die = min(cur_layer, layers - 1);
+
+			cur_block->layer = die;
+			dies_blocks[die].push_back(cur_block);
+			dies_area[die] += cur_block->bb.area;
+		}
+	}
+	// area-balanced assignment: largest blocks first, each to the die w/ currently
+	// smallest blocks area
+	else {
+		sort(blocks_sorted.begin(), blocks_sorted.end(),
+			// lambda expression
+			[&](Block const* b1, Block const* b2) {
+				return b1->bb.area > b2->bb.area;
+			}
+		    );
+
+		for (Block const* cur_block : blocks_sorted) {
+
+			die = min_element(dies_area.begin(), dies_area.end()) - dies_area.begin();
+
+			cur_block->layer = die;
+			dies_blocks[die].push_back(cur_block);
+			dies_area[die] += cur_block->bb.area;
+		}
+	}
+
+	/// CBL construction for each die
+	//
+	for (die = 0; die < layers; die++) {
+
+		CorblivarDie& cur_die = this->dies[die];
+
+		// consider blocks sorted by decreasing area
+		sort(dies_blocks[die].begin(), dies_blocks[die].end(),
+			// lambda expression
+			[&](Block const* b1, Block const* b2) {
+				return b1->bb.area > b2->bb.area;
+			}
+		    );
+
+		// reset die data; placement stacks are maintained during construction
+		cur_die.CBL.clear();
+		cur_die.modifiedCBL();
+		cur_die.Hi.clear();
+		cur_die.Vi.clear();
+		outline_x = outline_y = 0.0;
+
+		for (Block const* cur_block : dies_blocks[die]) {
+
+			// add new tuple, to be placed as current block
+			cur_die.CBL.S.push_back(cur_block);
+			cur_die.CBL.L.push_back(Direction::HORIZONTAL);
+			cur_die.CBL.T.push_back(0);
+			cur_die.pi = cur_die.CBL.size() - 1;
+
+			best_score = best_score_tie = -1.0;
+			best_dir = Direction::HORIZONTAL;
+			best_t = 0;
+
+			// evaluate all tuples (L, T), i.e., both insertion directions
+			// and all relevant T-junctions; the coordinates for each tuple
+			// are derived incrementally from the ones for the previous
+			// T-junction, equivalent to CorblivarDie::placeCurrentBlock w/o
+			// alignment
+			//
+			// for horizontal insertion and T-junctions t, the blocks
+			// covered are the first t + 1 blocks of stack Hi; the lower
+			// front y of these blocks is thus monotonically decreasing in t.
+			// All covered blocks are above y, i.e., they intersect
+			// vertically w/ the current block iff they start below its
+			// upper boundary y + h. This boundary is also decreasing in t,
+			// thus blocks not intersecting anymore can be dropped for good
+			// from the max heap of right fronts. Vertical insertion is
+			// handled analogously.
+			for (Direction const& dir : {Direction::HORIZONTAL, Direction::VERTICAL}) {
+
+				list<Block const*> const& stack = (dir == Direction::HORIZONTAL) ? cur_die.Hi : cur_die.Vi;
+				stack_size = max<unsigned>(1, stack.size());
+
+				// max heap of covered blocks' right (upper) fronts,
+				// along w/ their lower (left) boundaries
+				priority_queue< pair<double, double> > fronts;
+				list<Block const*>::const_iterator iter = stack.begin();
+				lower_front = -1.0;
+
+				for (t = 0; t < stack_size; t++) {
+
+					// cover next block of stack
+					if (iter != stack.end()) {
+
+						if (dir == Direction::HORIZONTAL) {
+							fronts.push({(*iter)->bb.ur.x, (*iter)->bb.ll.y});
+							lower_front = (lower_front == -1.0) ? (*iter)->bb.ll.y : min(lower_front, (*iter)->bb.ll.y);
+						}
+						else {
+							fronts.push({(*iter)->bb.ur.y, (*iter)->bb.ll.x});
+							lower_front = (lower_front == -1.0) ? (*iter)->bb.ll.x : min(lower_front, (*iter)->bb.ll.x);
+						}
+
+						++iter;
+					}
+
+					// first coordinate; all blocks covered, i.e., place
+					// block at the die boundary
+					first_coord = (iter == stack.end()) ? 0.0 : lower_front;
+
+					// second coordinate; drop blocks not intersecting
+					// anymore, the remaining top defines the front
+					if (dir == Direction::HORIZONTAL) {
+						upper_bound = cur_block->bb.h + first_coord;
+					}
+					else {
+						upper_bound = cur_block->bb.w + first_coord;
+					}
+					while (!fronts.empty() && fronts.top().second >= upper_bound) {
+						fronts.pop();
+					}
+					second_coord = fronts.empty() ? 0.0 : fronts.top().first;
+
+					if (dir == Direction::HORIZONTAL) {
+						trial_ur_x = cur_block->bb.w + second_coord;
+						trial_ur_y = upper_bound;
+					}
+					else {
+						trial_ur_x = upper_bound;
+						trial_ur_y = cur_block->bb.h + second_coord;
+					}
+
+					// score: max ratio of die outline and fixed outline,
+					// i.e., values <= 1.0 represent fitting layouts; ties
+					// are resolved by the sum of both ratios
+					cur_score = max(max(outline_x, trial_ur_x) / die_outline.x, max(outline_y, trial_ur_y) / die_outline.y);
+					cur_score_tie = max(outline_x, trial_ur_x) / die_outline.x + max(outline_y, trial_ur_y) / die_outline.y;
+
+					if (best_score == -1.0 || cur_score < best_score || (cur_score == best_score && cur_score_tie < best_score_tie)) {
+						best_score = cur_score;
+						best_score_tie = cur_score_tie;
+						best_dir = dir;
+						best_t = t;
+					}
+				}
+			}
+
+			// actual placement w/ best tuple
+			cur_die.CBL.L.back() = best_dir;
+			cur_die.CBL.T.back() = best_t;
+			cur_block->placed = false;
+
+			cur_die.placeCurrentBlock(false);
+
+			outline_x = max(outline_x, cur_block->bb.ur.x);
+			outline_y = max(outline_y, cur_block->bb.ur.y);
+		}
+
+		if (log) {
+			cout << "Corblivar> ";
+			cout << " Die " << die + 1 << "; blocks: " << cur_die.CBL.size() << "; outline: " << outline_x << " x " << outline_y << endl;
+		}
 	}
 
 	if (CorblivarCore::DBG) {
@@ -335,7 +603,6 @@ bool CorblivarCore::alignBlocks(CorblivarAlignmentReq const* req) {
 	Block const* b2;
 	CorblivarDie* die_b1;
 	CorblivarDie* die_b2;
-	list<Block const*> b1_relev_blocks, b2_relev_blocks;
 	Direction dir_b1, dir_b2;
 	bool b1_shifted, b2_shifted;
 	bool b1_to_shift_horizontal, b1_to_shift_vertical, b2_to_shift_horizontal, b2_to_shift_vertical;
@@ -356,8 +623,8 @@ bool CorblivarCore::alignBlocks(CorblivarAlignmentReq const* req) {
 		die_b2 = &this->dies[b2->layer];
 
 		// pop relevant blocks from related placement stacks
-		b1_relev_blocks = die_b1->popRelevantBlocks();
-		b2_relev_blocks = die_b2->popRelevantBlocks();
+		die_b1->popRelevantBlocks(this->b1_relev_blocks);
+		die_b2->popRelevantBlocks(this->b2_relev_blocks);
 
 		// first, we need to determine which insertion direction is to be applied
 		// for each block
@@ -380,8 +647,8 @@ bool CorblivarCore::alignBlocks(CorblivarAlignmentReq const* req) {
 				}
 
 				// first, determine blocks' y-coordinates
-				die_b1->determCurrentBlockCoords(Coordinate::Y, b1_relev_blocks);
-				die_b2->determCurrentBlockCoords(Coordinate::Y, b2_relev_blocks);
+				die_b1->determCurrentBlockCoords(Coordinate::Y, this->b1_relev_blocks);
+				die_b2->determCurrentBlockCoords(Coordinate::Y, this->b2_relev_blocks);
 
 				// perform shift in y-dir, if required and possible
 				b1_shifted = die_b1->shiftCurrentBlock(Direction::VERTICAL, req);
@@ -390,8 +657,8 @@ bool CorblivarCore::alignBlocks(CorblivarAlignmentReq const* req) {
 				// second, determine block's x-coordinates (depends on
 				// y-coord of relevant blocks and, more generally, on
 				// previously placed, possibly shifted blocks)
-				die_b1->determCurrentBlockCoords(Coordinate::X, b1_relev_blocks, true);
-				die_b2->determCurrentBlockCoords(Coordinate::X, b2_relev_blocks, true);
+				die_b1->determCurrentBlockCoords(Coordinate::X, this->b1_relev_blocks, true);
+				die_b2->determCurrentBlockCoords(Coordinate::X, this->b2_relev_blocks, true);
 
 				// perform shift in x-dir, if required and possible
 				b1_shifted = die_b1->shiftCurrentBlock(Direction::HORIZONTAL, req) || b1_shifted;
@@ -406,8 +673,8 @@ bool CorblivarCore::alignBlocks(CorblivarAlignmentReq const* req) {
 				}
 
 				// first, determine blocks' x-coordinates
-				die_b1->determCurrentBlockCoords(Coordinate::X, b1_relev_blocks);
-				die_b2->determCurrentBlockCoords(Coordinate::X, b2_relev_blocks);
+				die_b1->determCurrentBlockCoords(Coordinate::X, this->b1_relev_blocks);
+				die_b2->determCurrentBlockCoords(Coordinate::X, this->b2_relev_blocks);
 
 				// perform shift in x-dir, if required and possible
 				b1_shifted = die_b1->shiftCurrentBlock(Direction::HORIZONTAL, req);
@@ -416,8 +683,8 @@ bool CorblivarCore::alignBlocks(CorblivarAlignmentReq const* req) {
 				// second, determine block's y-coordinates (depends on
 				// x-coord of relevant blocks and, more generally, on
 				// previously placed, possibly shifted blocks)
-				die_b1->determCurrentBlockCoords(Coordinate::Y, b1_relev_blocks, true);
-				die_b2->determCurrentBlockCoords(Coordinate::Y, b2_relev_blocks, true);
+				die_b1->determCurrentBlockCoords(Coordinate::Y, this->b1_relev_blocks, true);
+				die_b2->determCurrentBlockCoords(Coordinate::Y, this->b2_relev_blocks, true);
 
 				// perform shift in y-dir, if required and possible
 				b1_shifted = die_b1->shiftCurrentBlock(Direction::VERTICAL, req) || b1_shifted;
@@ -435,20 +702,20 @@ bool CorblivarCore::alignBlocks(CorblivarAlignmentReq const* req) {
 
 			// initially, determine all coordinates
 			if (dir_b1 == Direction::HORIZONTAL) {
-				die_b1->determCurrentBlockCoords(Coordinate::Y, b1_relev_blocks);
-				die_b1->determCurrentBlockCoords(Coordinate::X, b1_relev_blocks, true);
+				die_b1->determCurrentBlockCoords(Coordinate::Y, this->b1_relev_blocks);
+				die_b1->determCurrentBlockCoords(Coordinate::X, this->b1_relev_blocks, true);
 			}
 			else {
-				die_b1->determCurrentBlockCoords(Coordinate::X, b1_relev_blocks);
-				die_b1->determCurrentBlockCoords(Coordinate::Y, b1_relev_blocks, true);
+				die_b1->determCurrentBlockCoords(Coordinate::X, this->b1_relev_blocks);
+				die_b1->determCurrentBlockCoords(Coordinate::Y, this->b1_relev_blocks, true);
 			}
 			if (dir_b2 == Direction::HORIZONTAL) {
-				die_b2->determCurrentBlockCoords(Coordinate::Y, b2_relev_blocks);
-				die_b2->determCurrentBlockCoords(Coordinate::X, b2_relev_blocks, true);
+				die_b2->determCurrentBlockCoords(Coordinate::Y, this->b2_relev_blocks);
+				die_b2->determCurrentBlockCoords(Coordinate::X, this->b2_relev_blocks, true);
 			}
 			else {
-				die_b2->determCurrentBlockCoords(Coordinate::X, b2_relev_blocks);
-				die_b2->determCurrentBlockCoords(Coordinate::Y, b2_relev_blocks, true);
+				die_b2->determCurrentBlockCoords(Coordinate::X, this->b2_relev_blocks);
+				die_b2->determCurrentBlockCoords(Coordinate::Y, this->b2_relev_blocks, true);
 			}
 
 			// second, determine which block is to be shifted in which direction
@@ -466,7 +733,7 @@ bool CorblivarCore::alignBlocks(CorblivarAlignmentReq const* req) {
 				// perform shifting of b1; helper also considers to shift
 				// b2 if required
 				CorblivarCore::sequentialShiftingHelper(
-						die_b1, die_b2, req, b1_relev_blocks, b2_relev_blocks, dir_b1, b1_shifted, b2_shifted);
+						die_b1, die_b2, req, this->b1_relev_blocks, this->b2_relev_blocks, dir_b1, b1_shifted, b2_shifted);
 			}
 
 			else if (b2_to_shift_horizontal && b2_to_shift_vertical) {
@@ -474,7 +741,7 @@ bool CorblivarCore::alignBlocks(CorblivarAlignmentReq const* req) {
 				// perform shifting of b2; helper also considers to shift
 				// b1 if required
 				CorblivarCore::sequentialShiftingHelper(
-						die_b2, die_b1, req, b2_relev_blocks, b1_relev_blocks, dir_b2, b2_shifted, b1_shifted);
+						die_b2, die_b1, req, this->b2_relev_blocks, this->b1_relev_blocks, dir_b2, b2_shifted, b1_shifted);
 			}
 
 			// b) one or both blocks are to be shifted in their first direction
@@ -513,23 +780,25 @@ bool CorblivarCore::alignBlocks(CorblivarAlignmentReq const* req) {
 		// since the corner-block front in both dimensions may be different now
 		//
 		if (b1_shifted) {
-			die_b1->rebuildPlacementStacks(b1_relev_blocks);
+			die_b1->rebuildPlacementStacks(this->b1_relev_blocks);
 		}
 		// if a block was not shifted, we can simply update the placement stacks
 		else {
-			die_b1->updatePlacementStacks(b1_relev_blocks);
+			die_b1->updatePlacementStacks(this->b1_relev_blocks);
 		}
 
 		if (b2_shifted) {
-			die_b2->rebuildPlacementStacks(b2_relev_blocks);
+			die_b2->rebuildPlacementStacks(this->b2_relev_blocks);
 		}
 		else {
-			die_b2->updatePlacementStacks(b2_relev_blocks);
+			die_b2->updatePlacementStacks(this->b2_relev_blocks);
 		}
 
 		// mark (shifted) blocks as placed
 		b1->placed = true;
 		b2->placed = true;
+		die_b1->updateOutline(b1);
+		die_b2->updateOutline(b2);
 
 		// placement stacks debugging
 		if (CorblivarDie::DBG_STACKS) {
@@ -580,7 +849,7 @@ bool CorblivarCore::alignBlocks(CorblivarAlignmentReq const* req) {
 		}
 
 		// pop relevant blocks from related placement stack
-		b1_relev_blocks = die_b1->popRelevantBlocks();
+		die_b1->popRelevantBlocks(this->b1_relev_blocks);
 
 		// horizontal placement
 		if (die_b1->getCurrentDirection() == Direction::HORIZONTAL) {
@@ -591,7 +860,7 @@ bool CorblivarCore::alignBlocks(CorblivarAlignmentReq const* req) {
 			}
 
 			// first, determine block's y-coordinates
-			die_b1->determCurrentBlockCoords(Coordinate::Y, b1_relev_blocks);
+			die_b1->determCurrentBlockCoords(Coordinate::Y, this->b1_relev_blocks);
 
 			// perform shift in y-dir, if required and possible
 			b1_shifted = die_b1->shiftCurrentBlock(Direction::VERTICAL, req);
@@ -599,7 +868,7 @@ bool CorblivarCore::alignBlocks(CorblivarAlignmentReq const* req) {
 			// second, determine block's x-coordinates (depends on y-coord of
 			// relevant blocks and, more generally, on previously placed,
 			// possibly shifted blocks)
-			die_b1->determCurrentBlockCoords(Coordinate::X, b1_relev_blocks, true);
+			die_b1->determCurrentBlockCoords(Coordinate::X, this->b1_relev_blocks, true);
 
 			// perform shift in x-dir, if required and possible
 			b1_shifted = die_b1->shiftCurrentBlock(Direction::HORIZONTAL, req) || b1_shifted;
@@ -613,7 +882,7 @@ bool CorblivarCore::alignBlocks(CorblivarAlignmentReq const* req) {
 			}
 
 			// first, determine block's x-coordinates
-			die_b1->determCurrentBlockCoords(Coordinate::X, b1_relev_blocks);
+			die_b1->determCurrentBlockCoords(Coordinate::X, this->b1_relev_blocks);
 
 			// perform shift in x-dir, if required and possible
 			b1_shifted = die_b1->shiftCurrentBlock(Direction::HORIZONTAL, req);
@@ -621,7 +890,7 @@ bool CorblivarCore::alignBlocks(CorblivarAlignmentReq const* req) {
 			// second, determine block's y-coordinates (depends on x-coord of
 			// relevant blocks and, more generally, on previously placed,
 			// possibly shifted blocks)
-			die_b1->determCurrentBlockCoords(Coordinate::Y, b1_relev_blocks, true);
+			die_b1->determCurrentBlockCoords(Coordinate::Y, this->b1_relev_blocks, true);
 
 			// perform shift in y-dir, if required and possible
 			b1_shifted = die_b1->shiftCurrentBlock(Direction::VERTICAL, req) || b1_shifted;
@@ -630,15 +899,16 @@ bool CorblivarCore::alignBlocks(CorblivarAlignmentReq const* req) {
 		// if the block was shifted, we need to rebuild the placement stacks since
 		// the corner-block front in both dimensions may be different now
 		if (b1_shifted) {
-			die_b1->rebuildPlacementStacks(b1_relev_blocks);
+			die_b1->rebuildPlacementStacks(this->b1_relev_blocks);
 		}
 		// if the block was not shifted, we can simply update the placement stacks
 		else {
-			die_b1->updatePlacementStacks(b1_relev_blocks);
+			die_b1->updatePlacementStacks(this->b1_relev_blocks);
 		}
 
 		// mark shifted block as placed
 		b1->placed = true;
+		die_b1->updateOutline(b1);
 
 		// placement stacks debugging
 		if (CorblivarDie::DBG_STACKS) {
@@ -649,7 +919,7 @@ bool CorblivarCore::alignBlocks(CorblivarAlignmentReq const* req) {
 	return true;
 }
 
-void CorblivarCore::sequentialShiftingHelper(CorblivarDie* die_b1, CorblivarDie* die_b2, CorblivarAlignmentReq const* req, list<Block const*> b1_relev_blocks, list<Block const*> b2_relev_blocks, Direction const& dir_b1, bool& b1_shifted, bool& b2_shifted) {
+void CorblivarCore::sequentialShiftingHelper(CorblivarDie* die_b1, CorblivarDie* die_b2, CorblivarAlignmentReq const* req, vector<Block const*> const& b1_relev_blocks, vector<Block const*> const& b2_relev_blocks, Direction const& dir_b1, bool& b1_shifted, bool& b2_shifted) {
 
 	// annotate that b1 is shifted at least in one direction
 	b1_shifted = true;
@@ -838,6 +1108,7 @@ void CorblivarCore::sortCBLs(bool const& log, int const& mode) {
 			die.CBL.L[t] = move(tuples[d][t].L);
 			die.CBL.T[t] = move(tuples[d][t].T);
 		}
+		die.modifiedCBL();
 
 		d++;
 	}
@@ -81,11 +81,29 @@ class CorblivarCore {
 		static void sequentialShiftingHelper(
 				CorblivarDie* die_b1, CorblivarDie* die_b2,
 				CorblivarAlignmentReq const* req,
-				list<Block const*> b1_relev_blocks, list<Block const*> b2_relev_blocks,
+				vector<Block const*> const& b1_relev_blocks, vector<Block const*> const& b2_relev_blocks,
 				Direction const& dir_b1,
 				bool& b1_shifted, bool& b2_shifted);
 		list<CorblivarAlignmentReq const*> findAlignmentReqs(Block const* b) const;
 
+		// scratch buffers for block alignment, i.e., relevant blocks popped from
+		// the placement stacks; reused across all alignment handlings in order to
+		// avoid repeated allocations
+		vector<Block const*> b1_relev_blocks, b2_relev_blocks;
+
+		// CBL-hash helper for layout-modification operations; toggles the keys
+		// of two tuples modified in place, along w/ the keys of their links
+		inline void toggleCBLHashes(int const& die1, int const& die2, int const& tuple1, int const& tuple2) {
+
+			if (die1 == die2) {
+				this->dies[die1].toggleCBLHash({tuple1, tuple2}, {tuple1, tuple1 + 1, tuple2, tuple2 + 1});
+			}
+			else {
+				this->dies[die1].toggleCBLHash({tuple1}, {tuple1, tuple1 + 1});
+				this->dies[die2].toggleCBLHash({tuple2}, {tuple2, tuple2 + 1});
+			}
+		};
+
 	// constructors, destructors, if any non-implicit
 	public:
 		CorblivarCore(int const& layers, unsigned const& blocks) {
@@ -93,11 +111,17 @@ class CorblivarCore {
 			// reserve mem for dies
 			this->dies.reserve(layers);
 
+			// reserve mem for alignment scratch buffers; worst case, i.e., all
+			// blocks popped from one stack
+			this->b1_relev_blocks.reserve(blocks);
+			this->b2_relev_blocks.reserve(blocks);
+
 			// init dies and their related structures
 			for (int i = 0; i < layers; i++) {
 				CorblivarDie cur_die = CorblivarDie(i);
 				// reserve mem for worst case, i.e., all blocks in one particular die
 				cur_die.CBL.reserve(blocks);
+				cur_die.relev_blocks.reserve(blocks);
 
 				this->dies.push_back(move(cur_die));
 			}
@@ -107,7 +131,8 @@ class CorblivarCore {
 	public:
 
 		// general operations
-		void initCorblivarRandomly(bool const& log, int const& layers, vector<Block> const& blocks, bool const& power_aware_assignment);
+		void initCorblivarRandomly(bool const& log, int const& layers, vector<Block> const& blocks, bool const& power_aware_assignment, bool const& layers_assigned = false);
+		void initCorblivarConstructively(bool const& log, int const& layers, vector<Block> const& blocks, bool const& power_aware_assignment, Point const& die_outline, bool const& layers_assigned = false);
 		bool generateLayout(bool const& perform_alignment);
 
 		// getter
@@ -124,7 +149,9 @@ class CorblivarCore {
 			return this->A;
 		};
 
-		// abstract layout-modification operations
+		// abstract layout-modification operations; the CBLs' hashes are updated
+		// incrementally, i.e., the keys of the modified tuples and their links
+		// are removed before and added after the modification
 		//
 		inline void swapBlocks(int const& die1, int const& die2, int const& tuple1, int const& tuple2) {
 
@@ -135,7 +162,13 @@ class CorblivarCore {
 			}
 
 			// perform swap
+			this->toggleCBLHashes(die1, die2, tuple1, tuple2);
 			swap(this->dies[die1].CBL.S[tuple1], this->dies[die2].CBL.S[tuple2]);
+			this->dies[die1].modifiedCBLHashed();
+			if (die1 != die2) {
+				this->dies[die2].modifiedCBLHashed();
+			}
+			this->toggleCBLHashes(die1, die2, tuple1, tuple2);
 
 			if (DBG) {
 				cout << "DBG_CORE> swapBlocks;";
@@ -162,12 +195,22 @@ class CorblivarCore {
 
 			// move within same die: perform swaps
 			if (die1 == die2) {
+				this->toggleCBLHashes(die1, die2, tuple1, tuple2);
+
 				swap(this->dies[die1].CBL.S[tuple1], this->dies[die2].CBL.S[tuple2]);
 				swap(this->dies[die1].CBL.L[tuple1], this->dies[die2].CBL.L[tuple2]);
 				swap(this->dies[die1].CBL.T[tuple1], this->dies[die2].CBL.T[tuple2]);
+
+				this->dies[die1].modifiedCBLHashed();
+				this->toggleCBLHashes(die1, die2, tuple1, tuple2);
 			}
-			// move across dies: perform insert and delete
+			// move across dies: perform insert and delete; only the links next
+			// to the moved tuple are affected, i.e., the links of tuple1 in die1
+			// and the link at the insertion position tuple2 in die2
 			else {
+				this->dies[die1].toggleCBLHash({tuple1}, {tuple1, tuple1 + 1});
+				this->dies[die2].toggleCBLHash({}, {tuple2});
+
 				// pre-update layer assignment for block to be moved
 				this->dies[die1].CBL.S[tuple1]->layer = die2;
 
@@ -180,16 +223,25 @@ class CorblivarCore {
 				this->dies[die1].CBL.S.erase(this->dies[die1].CBL.S.begin() + tuple1);
 				this->dies[die1].CBL.L.erase(this->dies[die1].CBL.L.begin() + tuple1);
 				this->dies[die1].CBL.T.erase(this->dies[die1].CBL.T.begin() + tuple1);
+
+				this->dies[die1].modifiedCBLHashed();
+				this->dies[die2].modifiedCBLHashed();
+
+				this->dies[die1].toggleCBLHash({}, {tuple1});
+				this->dies[die2].toggleCBLHash({tuple2}, {tuple2, tuple2 + 1});
 			}
 		};
 
 		inline void switchInsertionDirection(int const& die, int const& tuple) {
+			this->dies[die].toggleCBLHash({tuple}, {});
 			if (this->dies[die].CBL.L[tuple] == Direction::VERTICAL) {
 				this->dies[die].CBL.L[tuple] = Direction::HORIZONTAL;
 			}
 			else {
 				this->dies[die].CBL.L[tuple] = Direction::VERTICAL;
 			}
+			this->dies[die].modifiedCBLHashed();
+			this->dies[die].toggleCBLHash({tuple}, {});
 
 			if (DBG) {
 				cout << "DBG_CORE> switchInsertionDirection;";
@@ -201,7 +253,10 @@ class CorblivarCore {
 		};
 
 		inline void switchTupleJunctions(int const& die, int const& tuple, int const& juncts) {
+			this->dies[die].toggleCBLHash({tuple}, {});
 			this->dies[die].CBL.T[tuple] = juncts;
+			this->dies[die].modifiedCBLHashed();
+			this->dies[die].toggleCBLHash({tuple}, {});
 
 			if (DBG) {
 				cout << "DBG_CORE> switchTupleJunctions;";
@@ -232,26 +287,40 @@ class CorblivarCore {
 		static constexpr int SORT_CBLS_BY_BLOCKS_SIZE = 1;
 		void sortCBLs(bool const& log, int const& mode);
 
-		// CBL backup handler
+		// CBL copy handler; copies the CBL of the given die from another Corblivar
+		// core, whereas blocks are mapped to the given container via their
+		// numerical ids; required for parallel evaluation w/ separate copies of
+		// chip data
+		inline void copyCBL(CorblivarCore const& corb, unsigned const& die, vector<Block> const& blocks) {
+			CornerBlockList& CBL = this->dies[die].CBL;
+			CornerBlockList const& CBL_source = corb.dies[die].CBL;
+
+			CBL.S.clear();
+			for (Block const* b : CBL_source.S) {
+				CBL.S.push_back(&blocks[b->numerical_id]);
+			}
+			CBL.L = CBL_source.L;
+			CBL.T = CBL_source.T;
+
+			this->dies[die].modifiedCBL();
+		};
+
+		// CBL backup handler; the blocks' coordinates are always backed up since
+		// the layout may change also for unmodified CBLs, e.g., due to alignment
+		// or block shaping; the CBLs themselves are only copied if modified since
+		// the last backup, using bulk vector copies
 		inline void backupCBLs() {
 
 			for (CorblivarDie& die : this->dies) {
 
-				die.CBLbackup.clear();
-				die.CBLbackup.reserve(die.CBL.capacity());
-
+				// backup bb into blocks themselves
 				for (Block const* b : die.CBL.S) {
-
-					// backup bb into block itself
 					b->bb_backup = b->bb;
-
-					die.CBLbackup.S.push_back(b);
-				}
-				for (Direction const& dir : die.CBL.L) {
-					die.CBLbackup.L.push_back(dir);
 				}
-				for (unsigned const& t_juncts : die.CBL.T) {
-					die.CBLbackup.T.push_back(t_juncts);
+
+				if (die.CBLbackup_version != die.CBL_version) {
+					die.CBLbackup = die.CBL;
+					die.CBLbackup_version = die.CBL_version;
 				}
 			}
 		};
@@ -259,47 +328,40 @@ class CorblivarCore {
 
 			for (CorblivarDie& die : this->dies) {
 
-				die.CBL.clear();
-				die.CBL.reserve(die.CBLbackup.capacity());
-
-				for (Block const* b : die.CBLbackup.S) {
+				if (die.CBL_version != die.CBLbackup_version) {
+					die.CBL = die.CBLbackup;
 
-					// restore bb from block itself
-					b->bb = b->bb_backup;
-					// update layer assignment
-					b->layer = die.id;
+					// restored CBL is the version of the backup; a hash is
+					// only up-to-date if determined for exactly this version
+					die.CBL_version = die.CBLbackup_version;
 
-					die.CBL.S.push_back(b);
-				}
-				for (Direction const& dir : die.CBLbackup.L) {
-					die.CBL.L.push_back(dir);
+					// update layer assignment; only required for modified
+					// CBLs since layers are only changed along w/ CBLs
+					for (Block const* b : die.CBL.S) {
+						b->layer = die.id;
+					}
 				}
-				for (unsigned const& t_juncts : die.CBLbackup.T) {
-					die.CBL.T.push_back(t_juncts);
+
+				// restore bb from blocks themselves
+				for (Block const* b : die.CBL.S) {
+					b->bb = b->bb_backup;
 				}
 			}
 		};
 
-		// CBL best-solution handler
+		// CBL best-solution handler; similar to backup handler
 		inline void storeBestCBLs() {
 
 			for (CorblivarDie& die : this->dies) {
 
-				die.CBLbest.clear();
-				die.CBLbest.reserve(die.CBL.capacity());
-
+				// backup bb into blocks themselves
 				for (Block const* b : die.CBL.S) {
-
-					// backup bb into block itself
 					b->bb_best = b->bb;
-
-					die.CBLbest.S.push_back(b);
-				}
-				for (Direction const& dir : die.CBL.L) {
-					die.CBLbest.L.push_back(dir);
 				}
-				for (unsigned const& t_juncts : die.CBL.T) {
-					die.CBLbest.T.push_back(t_juncts);
+
+				if (die.CBLbest_version != die.CBL_version) {
+					die.CBLbest = die.CBL;
+					die.CBLbest_version = die.CBL_version;
 				}
 			}
 		};
@@ -311,28 +373,26 @@ class CorblivarCore {
 
 			for (CorblivarDie& die : this->dies) {
 
-				die.CBL.clear();
-				die.CBL.reserve(die.CBLbest.capacity());
+				if (die.CBL_version != die.CBLbest_version) {
+					die.CBL = die.CBLbest;
+
+					// applied CBL is the version of the best CBL
+					die.CBL_version = die.CBLbest_version;
+
+					// update layer assignment
+					for (Block const* b : die.CBL.S) {
+						b->layer = die.id;
+					}
+				}
 
-				if (die.CBLbest.empty()) {
+				if (die.CBL.empty()) {
 					empty_dies++;
 					continue;
 				}
 
-				for (Block const* b : die.CBLbest.S) {
-
-					// restore bb from block itself
+				// restore bb from blocks themselves
+				for (Block const* b : die.CBL.S) {
 					b->bb = b->bb_best;
-					// update layer assignment
-					b->layer = die.id;
-
-					die.CBL.S.push_back(b);
-				}
-				for (Direction const& dir : die.CBLbest.L) {
-					die.CBL.L.push_back(dir);
-				}
-				for (unsigned const& t_juncts : die.CBLbest.T) {
-					die.CBL.T.push_back(t_juncts);
 				}
 			}
 
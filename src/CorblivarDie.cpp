@@ -29,7 +29,6 @@
 #include "CorblivarCore.hpp"
 
 void CorblivarDie::placeCurrentBlock(bool const& alignment_enabled) {
-	list<Block const*> relevBlocks;
 
 	// current tuple; only mutable block parameters can be edited
 	Block const* cur_block = this->getCurrentBlock();
@@ -41,34 +40,35 @@ void CorblivarDie::placeCurrentBlock(bool const& alignment_enabled) {
 	}
 
 	// pop relevant blocks from related placement stack
-	relevBlocks = this->popRelevantBlocks();
+	this->popRelevantBlocks(this->relev_blocks);
 
 	// horizontal placement
 	if (this->getCurrentDirection() == Direction::HORIZONTAL) {
 
 		// first, determine block's y-coordinates
-		this->determCurrentBlockCoords(Coordinate::Y, relevBlocks);
+		this->determCurrentBlockCoords(Coordinate::Y, this->relev_blocks);
 		// second, determine block's x-coordinates (depends on y-coord; extended
 		// check depends on whether alignment is enabled, i.e., whether some
 		// blocks might be shifted)
-		this->determCurrentBlockCoords(Coordinate::X, relevBlocks, alignment_enabled);
+		this->determCurrentBlockCoords(Coordinate::X, this->relev_blocks, alignment_enabled);
 	}
 	// vertical placement
 	else {
 
 		// first, determine block's x-coordinates
-		this->determCurrentBlockCoords(Coordinate::X, relevBlocks);
+		this->determCurrentBlockCoords(Coordinate::X, this->relev_blocks);
 		// second, determine block's y-coordinates (depends on x-coord; extended
 		// check depends on whether alignment is enabled, i.e., whether some
 		// blocks might be shifted)
-		this->determCurrentBlockCoords(Coordinate::Y, relevBlocks, alignment_enabled);
+		this->determCurrentBlockCoords(Coordinate::Y, this->relev_blocks, alignment_enabled);
 	}
 
 	// update placement stacks
-	this->updatePlacementStacks(relevBlocks);
+	this->updatePlacementStacks(this->relev_blocks);
 
 	// mark block as placed
 	cur_block->placed = true;
+	this->updateOutline(cur_block);
 
 	// placement stacks debugging
 	if (CorblivarDie::DBG_STACKS) {
@@ -76,6 +76,83 @@ void CorblivarDie::placeCurrentBlock(bool const& alignment_enabled) {
 	}
 }
 
+// note that blocks are only shifted to the right or upwards before they are marked as
+// placed; thus, considering the final coordinates of each placed block is sufficient
+void CorblivarDie::updateOutline(Block const* block) {
+	this->outline.x = max(this->outline.x, block->bb.ur.x);
+	this->outline.y = max(this->outline.y, block->bb.ur.y);
+}
+
+// each tuple contributes the key of its block, direction and junctions, and each link
+// the key of the blocks of two subsequent tuples; the links capture the order of
+// tuples w/o considering their positions, thus operations inserting or deleting
+// tuples only affect the links next to the modified tuples. The die's id is
+// considered for all keys
+unsigned long long CorblivarDie::getCBLHash() const {
+	int t;
+
+	if (this->CBL_hash_version != this->CBL_version) {
+
+		this->CBL_hash = 0;
+
+		for (t = 0; t < static_cast<int>(this->CBL.size()); t++) {
+			this->CBL_hash ^= this->tupleHash(t);
+		}
+		for (t = 0; t <= static_cast<int>(this->CBL.size()); t++) {
+			this->CBL_hash ^= this->linkHash(t);
+		}
+
+		this->CBL_hash_version = this->CBL_version;
+	}
+
+	return this->CBL_hash;
+}
+
+// the lowest bit distinguishes tuple and link keys
+unsigned long long CorblivarDie::tupleHash(int const& tuple) const {
+	unsigned long long hash;
+
+	hash = Math::hash((static_cast<unsigned long long>(this->id) << 32) | this->CBL.S[tuple]->numerical_id);
+	hash = Math::hash(hash ^ (((static_cast<unsigned long long>(this->CBL.T[tuple]) << 1) | static_cast<unsigned>(this->CBL.L[tuple])) << 1));
+
+	return hash;
+}
+
+unsigned long long CorblivarDie::linkHash(int const& link) const {
+	unsigned long long hash;
+	int prev, next;
+
+	// pseudo tuples for begin and end of CBL are represented by id -1
+	prev = (link > 0) ? this->CBL.S[link - 1]->numerical_id : -1;
+	next = (link < static_cast<int>(this->CBL.size())) ? this->CBL.S[link]->numerical_id : -1;
+
+	hash = Math::hash((static_cast<unsigned long long>(this->id) << 32) | static_cast<unsigned>(prev + 1));
+	hash = Math::hash(hash ^ ((static_cast<unsigned long long>(next + 1) << 1) | 1));
+
+	return hash;
+}
+
+// tuples and links may be given multiple times, e.g., for swapping adjacent tuples;
+// each key is considered only once
+void CorblivarDie::toggleCBLHash(vector<int> tuples, vector<int> links) {
+
+	if (this->CBL_hash_version != this->CBL_version) {
+		return;
+	}
+
+	sort(tuples.begin(), tuples.end());
+	tuples.erase(unique(tuples.begin(), tuples.end()), tuples.end());
+	sort(links.begin(), links.end());
+	links.erase(unique(links.begin(), links.end()), links.end());
+
+	for (int const& t : tuples) {
+		this->CBL_hash ^= this->tupleHash(t);
+	}
+	for (int const& l : links) {
+		this->CBL_hash ^= this->linkHash(l);
+	}
+}
+
 void CorblivarDie::debugStacks() {
 	Block const* cur_block = this->getCurrentBlock();
 	list<Block const*>::iterator iter;
@@ -140,10 +217,12 @@ bool CorblivarDie::debugLayout() const {
 	return invalid;
 }
 
-list<Block const*> CorblivarDie::popRelevantBlocks() {
-	list<Block const*> ret;
+void CorblivarDie::popRelevantBlocks(vector<Block const*>& relev_blocks) {
 	unsigned blocks_count;
 
+	// reset buffer; retains its capacity
+	relev_blocks.clear();
+
 	// horizontal placement; consider stack Hi
 	if (this->getCurrentDirection() == Direction::HORIZONTAL) {
 
@@ -151,9 +230,9 @@ list<Block const*> CorblivarDie::popRelevantBlocks() {
 		// current stack itself
 		blocks_count = min<unsigned>(this->getJunctions(this->pi) + 1, this->Hi.size());
 
-		// pop relevant blocks from stack into return list
-		while (blocks_count > ret.size()) {
-			ret.push_back(move(this->Hi.front()));
+		// pop relevant blocks from stack into buffer
+		while (blocks_count > relev_blocks.size()) {
+			relev_blocks.push_back(this->Hi.front());
 			this->Hi.pop_front();
 		}
 	}
@@ -164,17 +243,15 @@ list<Block const*> CorblivarDie::popRelevantBlocks() {
 		// current stack itself
 		blocks_count = min<unsigned>(this->getJunctions(this->pi) + 1, this->Vi.size());
 
-		// pop relevant blocks from stack into return list
-		while (blocks_count > ret.size()) {
-			ret.push_back(move(this->Vi.front()));
+		// pop relevant blocks from stack into buffer
+		while (blocks_count > relev_blocks.size()) {
+			relev_blocks.push_back(this->Vi.front());
 			this->Vi.pop_front();
 		}
 	}
-
-	return ret;
 }
 
-void CorblivarDie::updatePlacementStacks(list<Block const*>& relev_blocks_stack) {
+void CorblivarDie::updatePlacementStacks(vector<Block const*> const& relev_blocks_stack) {
 	bool add_to_stack;
 	Block const* b;
 
@@ -230,7 +307,7 @@ void CorblivarDie::updatePlacementStacks(list<Block const*>& relev_blocks_stack)
 		// by reverse iteration, we retain the (implicit) ordering of blocks
 		// popped from stack Hi regarding their insertion order; required for
 		// proper stack manipulation
-		for (list<Block const*>::reverse_iterator r_iter = relev_blocks_stack.rbegin(); r_iter != relev_blocks_stack.rend(); ++r_iter) {
+		for (vector<Block const*>::const_reverse_iterator r_iter = relev_blocks_stack.rbegin(); r_iter != relev_blocks_stack.rend(); ++r_iter) {
 			b = *r_iter;
 
 			if (!Rect::rectA_leftOf_rectB(b->bb, cur_block->bb, true)) {
@@ -269,7 +346,7 @@ void CorblivarDie::updatePlacementStacks(list<Block const*>& relev_blocks_stack)
 		// iteration, we retain the (implicit) ordering of blocks popped from
 		// stack Vi regarding their insertion order; required for proper stack
 		// manipulation
-		for (list<Block const*>::reverse_iterator r_iter = relev_blocks_stack.rbegin(); r_iter != relev_blocks_stack.rend(); ++r_iter) {
+		for (vector<Block const*>::const_reverse_iterator r_iter = relev_blocks_stack.rbegin(); r_iter != relev_blocks_stack.rend(); ++r_iter) {
 			b = *r_iter;
 
 			if (!Rect::rectA_below_rectB(b->bb, cur_block->bb, true)) {
@@ -279,9 +356,8 @@ void CorblivarDie::updatePlacementStacks(list<Block const*>& relev_blocks_stack)
 	}
 }
 
-void CorblivarDie::rebuildPlacementStacks(list<Block const*>& relev_blocks_stack) {
+void CorblivarDie::rebuildPlacementStacks(vector<Block const*> const& relev_blocks_stack) {
 	list<Block const*>::iterator iter;
-	list<Block const*> stack_backup;
 	bool covered;
 
 	// current block
@@ -427,7 +503,7 @@ void CorblivarDie::rebuildPlacementStacks(list<Block const*>& relev_blocks_stack
 		// first, try to fix Hi
 		//
 		// local copy Hi for backup
-		stack_backup = this->Hi;
+		this->stack_backup = this->Hi;
 
 		// try dropping blocks until corner blocks match
 		while (this->Hi.front() != this->Vi.front()) {
@@ -444,10 +520,10 @@ void CorblivarDie::rebuildPlacementStacks(list<Block const*>& relev_blocks_stack
 		if (this->Hi.empty()) {
 
 			// restore Hi
-			this->Hi = stack_backup;
+			this->Hi = this->stack_backup;
 
 			// local copy Vi for backup
-			stack_backup = this->Vi;
+			this->stack_backup = this->Vi;
 
 			// try dropping blocks until corner blocks match
 			while (this->Hi.front() != this->Vi.front()) {
@@ -465,7 +541,7 @@ void CorblivarDie::rebuildPlacementStacks(list<Block const*>& relev_blocks_stack
 			if (this->Vi.empty()) {
 
 				// restore Vi
-				this->Vi = stack_backup;
+				this->Vi = this->stack_backup;
 
 				// dbg log for failure
 				if (CorblivarDie::DBG_STACKS) {
@@ -476,7 +552,7 @@ void CorblivarDie::rebuildPlacementStacks(list<Block const*>& relev_blocks_stack
 	}
 }
 
-void CorblivarDie::determCurrentBlockCoords(Coordinate const& coord, list<Block const*> const& relev_blocks_stack, bool const& extended_check) const {
+void CorblivarDie::determCurrentBlockCoords(Coordinate const& coord, vector<Block const*> const& relev_blocks_stack, bool const& extended_check) const {
 	double x, y;
 
 	// current block
@@ -655,7 +731,6 @@ bool CorblivarDie::shiftCurrentBlock(Direction const& dir, CorblivarAlignmentReq
 	double shift_x, shift_y;
 	double range_x, range_y;
 	double neighbor_x, neighbor_y;
-	bool neighbor_x_found, neighbor_y_found;
 	bool shifted;
 
 	// block to shift is current block
@@ -713,33 +788,9 @@ bool CorblivarDie::shiftCurrentBlock(Direction const& dir, CorblivarAlignmentReq
 			// shifting ranges in cases where the block to be shifted
 			// is implicitly packed w/in the corner-blocks front
 			//
-			neighbor_x = 0.0;
-			neighbor_x_found =  false;
-			// walk all blocks (implicitly ordered such that placed blocks are first)
-			for (unsigned b = 0; b < this->getCBL().size(); b++) {
-
-				if (this->getBlock(b)->id == shift_block->id) {
-					break;
-				}
-				else {
-					// for shifting to the right, check for
-					// right neigbhors
-					if (Rect::rectA_leftOf_rectB(shift_block->bb, this->getBlock(b)->bb, true)) {
-
-						if (!neighbor_x_found) {
-							neighbor_x_found = true;
-							neighbor_x = this->getBlock(b)->bb.ll.x;
-						}
-						else {
-							neighbor_x = min(neighbor_x, this->getBlock(b)->bb.ll.x);
-						}
-					}
-				}
-			}
-
 			// some relevant neighbor found, i.e., shifting is
 			// restricted in order to avoid overlaps
-			if (neighbor_x_found) {
+			if (this->shiftingNeighbor(Direction::HORIZONTAL, shift_block, neighbor_x)) {
 
 				shift_x = min(shift_x, neighbor_x - shift_block->bb.ur.x);
 			}
@@ -821,33 +872,9 @@ bool CorblivarDie::shiftCurrentBlock(Direction const& dir, CorblivarAlignmentReq
 			// shifting ranges in cases where the block to be shifted
 			// is implicitly packed w/in the corner-blocks front
 			//
-			neighbor_y = 0.0;
-			neighbor_y_found =  false;
-			// walk all blocks (implicitly ordered such that placed blocks are first)
-			for (unsigned b = 0; b < this->getCBL().size(); b++) {
-
-				if (this->getBlock(b)->id == shift_block->id) {
-					break;
-				}
-				else {
-					// for shifting to the top, check for
-					// neigbhors above
-					if (Rect::rectA_below_rectB(shift_block->bb, this->getBlock(b)->bb, true)) {
-
-						if (!neighbor_y_found) {
-							neighbor_y_found = true;
-							neighbor_y = this->getBlock(b)->bb.ll.y;
-						}
-						else {
-							neighbor_y = min(neighbor_y, this->getBlock(b)->bb.ll.y);
-						}
-					}
-				}
-			}
-
 			// some relevant neighbor found, i.e., shifting is
 			// restricted in order to avoid overlaps
-			if (neighbor_y_found) {
+			if (this->shiftingNeighbor(Direction::VERTICAL, shift_block, neighbor_y)) {
 
 				shift_y = min(shift_y, neighbor_y - shift_block->bb.ur.y);
 			}
@@ -894,6 +921,66 @@ bool CorblivarDie::shiftCurrentBlock(Direction const& dir, CorblivarAlignmentReq
 	return shifted;
 }
 
+bool CorblivarDie::shiftingNeighbor(Direction const& dir, Block const* shift_block, double& neighbor) {
+	ShiftingNeighbor& cached = this->shifting_neighbors[static_cast<unsigned>(dir)];
+
+	// reuse previous lookup if the block to shift was not moved since; the previously
+	// placed blocks considered below are not moved anymore during layout generation
+	if (cached.block == shift_block &&
+			cached.ll.x == shift_block->bb.ll.x && cached.ll.y == shift_block->bb.ll.y &&
+			cached.ur.x == shift_block->bb.ur.x && cached.ur.y == shift_block->bb.ur.y) {
+
+		neighbor = cached.coord;
+		return cached.found;
+	}
+
+	cached.block = shift_block;
+	cached.ll = shift_block->bb.ll;
+	cached.ur = shift_block->bb.ur;
+	cached.found = false;
+	cached.coord = 0.0;
+
+	// walk all blocks (implicitly ordered such that placed blocks are first)
+	for (unsigned b = 0; b < this->getCBL().size(); b++) {
+
+		if (this->getBlock(b)->id == shift_block->id) {
+			break;
+		}
+
+		// for shifting to the right, check for right neigbhors
+		if (dir == Direction::HORIZONTAL) {
+
+			if (Rect::rectA_leftOf_rectB(shift_block->bb, this->getBlock(b)->bb, true)) {
+
+				if (!cached.found) {
+					cached.found = true;
+					cached.coord = this->getBlock(b)->bb.ll.x;
+				}
+				else {
+					cached.coord = min(cached.coord, this->getBlock(b)->bb.ll.x);
+				}
+			}
+		}
+		// for shifting to the top, check for neigbhors above
+		else {
+
+			if (Rect::rectA_below_rectB(shift_block->bb, this->getBlock(b)->bb, true)) {
+
+				if (!cached.found) {
+					cached.found = true;
+					cached.coord = this->getBlock(b)->bb.ll.y;
+				}
+				else {
+					cached.coord = min(cached.coord, this->getBlock(b)->bb.ll.y);
+				}
+			}
+		}
+	}
+
+	neighbor = cached.coord;
+	return cached.found;
+}
+
 // note that packing may undermine alignment requests; to avoid this, we call
 // FloorPlanner::determCostAlignment before packing but after layout generation
 // (FloorPlanner::determCostAlignment does annotate alignment success / failure to the
@@ -1102,4 +1189,18 @@ void CorblivarDie::performPacking(Direction const& dir) {
 			block->bb.ur.y = block->bb.h + y;
 		}
 	}
+
+	// packing may reduce the outline in the packed dimension; redetermine it
+	if (dir == Direction::HORIZONTAL) {
+		this->outline.x = 0.0;
+		for (Block const* b : blocks) {
+			this->outline.x = max(this->outline.x, b->bb.ur.x);
+		}
+	}
+	else {
+		this->outline.y = 0.0;
+		for (Block const* b : blocks) {
+			this->outline.y = max(this->outline.y, b->bb.ur.y);
+		}
+	}
 }
@@ -30,6 +30,7 @@
 #include "CornerBlockList.hpp"
 #include "CorblivarAlignmentReq.hpp"
 #include "Coordinate.hpp"
+#include "Point.hpp"
 // forward declarations, if any
 class Block;
 
@@ -57,6 +58,72 @@ class CorblivarDie {
 		// backup CBL sequences
 		CornerBlockList CBLbackup, CBLbest;
 
+		// CBL versioning; a new version is drawn for any modification of the
+		// CBL, and the backup CBLs memorize the version they are a copy of; this
+		// way, backing up and restoring is limited to actually modified CBLs, and
+		// restored CBLs retain the version of their backup. Note that new
+		// versions are drawn from a counter which only increases, i.e., a version
+		// is never reused for different CBL sequences, even after restoring
+		unsigned long CBL_version, CBLbackup_version, CBLbest_version;
+		unsigned long CBL_versions;
+
+		// CBL versioning; to be called for any modification of the CBL
+		inline void modifiedCBL() {
+			this->CBL_version = ++this->CBL_versions;
+		};
+		// CBL versioning; to be called for modifications covered by incremental
+		// hash updates, see toggleCBLHash, i.e., an up-to-date hash remains
+		// up-to-date
+		inline void modifiedCBLHashed() {
+			bool hash_valid = (this->CBL_hash_version == this->CBL_version);
+
+			this->CBL_version = ++this->CBL_versions;
+
+			if (hash_valid) {
+				this->CBL_hash_version = this->CBL_version;
+			}
+		};
+
+		// CBL hash, i.e., Zobrist-style hash over all tuples and all links of
+		// subsequent tuples; determined on demand and memorized for the CBL
+		// version it was determined for. The CBL's layout-modification
+		// operations update the hash incrementally
+		mutable unsigned long long CBL_hash;
+		mutable unsigned long CBL_hash_version;
+		// CBL hash: key of tuple, i.e., of its block, direction and junctions;
+		// key of link i, i.e., of the blocks of tuples i - 1 and i, where the
+		// begin and end of the CBL are considered as pseudo tuples
+		unsigned long long tupleHash(int const& tuple) const;
+		unsigned long long linkHash(int const& link) const;
+		// CBL hash, incremental update; the keys of the given tuples and links are
+		// XORed into an up-to-date hash. To be called before and after modifying
+		// these tuples, i.e., the keys of the previous tuples are removed and the
+		// keys of the modified tuples are added
+		void toggleCBLHash(vector<int> tuples, vector<int> links);
+
+		// outline of the die's layout, i.e., max upper-right coordinates of all
+		// blocks; maintained during layout generation and packing
+		Point outline;
+
+		// scratch buffers for layout generation; reused across all placements in
+		// order to avoid repeated allocations
+		//
+		// relevant blocks popped from stacks, for regular placement
+		vector<Block const*> relev_blocks;
+		// stack backup, for rebuilding the placement stacks
+		list<Block const*> stack_backup;
+
+		// cached neighbor lookups for block shifting, one per direction; the
+		// dry runs during alignment handling and the actual shifting thereafter
+		// share the lookup as long as the block to shift was not moved in
+		// between
+		struct ShiftingNeighbor {
+			Block const* block = nullptr;
+			Point ll, ur;
+			bool found;
+			double coord;
+		} shifting_neighbors[2];
+
 		// reset handler
 		inline void reset() {
 
@@ -70,6 +137,14 @@ class CorblivarDie {
 			this->Hi.clear();
 			this->Vi.clear();
 
+			// reset outline
+			this->outline.x = this->outline.y = 0.0;
+
+			// reset cached neighbor lookups; previously placed blocks may
+			// differ for new layout
+			this->shifting_neighbors[0].block = nullptr;
+			this->shifting_neighbors[1].block = nullptr;
+
 			// reset placed flags
 			for (Block const* b : this->CBL.S) {
 				b->placed = false;
@@ -90,22 +165,34 @@ class CorblivarDie {
 		void placeCurrentBlock(bool const& alignment_enabled);
 		// layout generation: block shifting
 		bool shiftCurrentBlock(Direction const& dir, CorblivarAlignmentReq const* req, bool const& dry_run = false);
+		// layout-generation helper: determine nearest previously placed neighbor
+		// restricting the shifting of the current block, i.e., the right neighbor
+		// for horizontal shifting and the neighbor above for vertical shifting
+		bool shiftingNeighbor(Direction const& dir, Block const* shift_block, double& neighbor);
 
 		// layout-generation helper: determine coordinates of block in process
-		void determCurrentBlockCoords(Coordinate const& coord, list<Block const*> const& relev_blocks_stack, bool const& extended_check = false) const;
+		void determCurrentBlockCoords(Coordinate const& coord, vector<Block const*> const& relev_blocks_stack, bool const& extended_check = false) const;
 		// layout-generation helper: pop relevant blocks to consider during
-		// placement from stacks
-		list<Block const*> popRelevantBlocks();
+		// placement from stacks into (reused) buffer
+		void popRelevantBlocks(vector<Block const*>& relev_blocks);
 		// layout-generation helper: update placement stack (after placement)
-		void updatePlacementStacks(list<Block const*>& relev_blocks_stack);
+		void updatePlacementStacks(vector<Block const*> const& relev_blocks_stack);
 		// layout-generation helper: rebuild placement stack (after block shifting)
-		void rebuildPlacementStacks(list<Block const*>& relev_blocks_stack);
+		void rebuildPlacementStacks(vector<Block const*> const& relev_blocks_stack);
+		// layout-generation helper: update outline w/ (finally) placed block
+		void updateOutline(Block const* block);
 		// layout-generation helper: placement stacks debugging
 		void debugStacks();
 
 	// constructors, destructors, if any non-implicit
 	public:
 		CorblivarDie(int const& id) {
+			this->CBL_version = this->CBL_versions = 1;
+			this->CBLbackup_version = this->CBLbest_version = 0;
+			// no hash determined yet; note that version 0 is not applicable
+			// here, as it refers to the initial, empty backup CBLs
+			this->CBL_hash_version = numeric_limits<unsigned long>::max();
+			this->outline.x = this->outline.y = 0.0;
 			this->stalled = false;
 			this->done = false;
 			this->id = id;
@@ -115,8 +202,9 @@ class CorblivarDie {
 	public:
 		friend class CorblivarCore;
 
-		// setter
+		// setter; any access is considered as modification
 		inline CornerBlockList& editCBL() {
+			this->modifiedCBL();
 			return this->CBL;
 		};
 
@@ -136,6 +224,12 @@ class CorblivarDie {
 		inline Direction const& getCurrentDirection() const {
 			return this->CBL.L[this->pi];
 		};
+		inline Point const& getOutline() const {
+			return this->outline;
+		};
+		// hash of the CBL; also considers the die's id, i.e., hashes of
+		// different dies can be combined via XOR
+		unsigned long long getCBLHash() const;
 		inline unsigned const& getJunctions(unsigned const& tuple) const {
 			return this->CBL.T[tuple];
 		};
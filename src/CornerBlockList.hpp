@@ -102,6 +102,14 @@ class CornerBlockList {
 			this->T.reserve(elements);
 		};
 
+		// map the blocks to the given container, by numerical ids; required for
+		// CBLs of copied chip data
+		inline void mapBlocks(vector<Block> const& blocks) {
+			for (Block const*& b : this->S) {
+				b = &blocks[b->numerical_id];
+			}
+		};
+
 		inline void insert(Tuple&& tuple) {
 			this->S.push_back(tuple.S);
 			this->L.push_back(tuple.L);
@@ -31,12 +31,1525 @@
 #include "Net.hpp"
 #include "IO.hpp"
 #include "Chip.hpp"
+#include "Partitioner.hpp"
 
 // memory allocation
 constexpr int FloorPlanner::OP_SWAP_BLOCKS;
 constexpr int FloorPlanner::OP_MOVE_TUPLE;
+constexpr double FloorPlanner::SA_HIERARCHICAL_LOOP_FACTOR;
+constexpr double FloorPlanner::SA_HIERARCHICAL_CLUSTER_AR_MIN;
+constexpr double FloorPlanner::SA_HIERARCHICAL_CLUSTER_AR_MAX;
+constexpr int FloorPlanner::SA_THERMAL_LEVELS_FACTOR[];
+constexpr double FloorPlanner::SA_THERMAL_LEVELS_TEMP[];
+constexpr unsigned FloorPlanner::FITTING_STARTS;
+constexpr double FloorPlanner::FITTING_PDPZ_MAX;
+constexpr double FloorPlanner::FITTING_TOLERANCE;
+
+// copy constructor; copies chip data, config and SA state, whereas pointers within the
+// copied nets and archived CBLs are mapped to the copied blocks and pins
+FloorPlanner::FloorPlanner(FloorPlanner const& fp) {
+
+	// chip data
+	this->blocks = fp.blocks;
+	this->terminals = fp.terminals;
+	this->nets = fp.nets;
+	this->blocks_nets = fp.blocks_nets;
+	this->TSVs = fp.TSVs;
+
+	for (Net& net : this->nets) {
+		for (Block const*& b : net.blocks) {
+			b = &this->blocks[b->numerical_id];
+		}
+		for (Pin const*& pin : net.terminals) {
+			pin = &this->terminals[pin->numerical_id];
+		}
+	}
+
+	// 3D IC config parameters and characteristica
+	this->conf_layers = fp.conf_layers;
+	this->conf_outline_x = fp.conf_outline_x;
+	this->conf_outline_y = fp.conf_outline_y;
+	this->conf_blocks_scale = fp.conf_blocks_scale;
+	this->conf_outline_shrink = fp.conf_outline_shrink;
+	this->die_AR = fp.die_AR;
+	this->die_area = fp.die_area;
+	this->dies_outline = fp.dies_outline;
+	this->blocks_area = fp.blocks_area;
+	this->stack_area = fp.stack_area;
+	this->stack_deadspace = fp.stack_deadspace;
+
+	// IO; note that streams are not copied
+	this->benchmark = fp.benchmark;
+	this->config_file = fp.config_file;
+	this->blocks_file = fp.blocks_file;
+	this->alignments_file = fp.alignments_file;
+	this->pins_file = fp.pins_file;
+	this->power_density_file = fp.power_density_file;
+	this->nets_file = fp.nets_file;
+	this->start = fp.start;
+	this->power_density_file_avail = fp.power_density_file_avail;
+	this->alignments_file_avail = fp.alignments_file_avail;
+	this->conf_log = fp.conf_log;
+
+	// SA parameters and cost variables
+	this->conf_SA_loopFactor = fp.conf_SA_loopFactor;
+	this->conf_SA_loopLimit = fp.conf_SA_loopLimit;
+	this->conf_SA_early_termination_steps = fp.conf_SA_early_termination_steps;
+	this->conf_SA_early_termination_std_dev = fp.conf_SA_early_termination_std_dev;
+	this->SA_early_termination_step = fp.SA_early_termination_step;
+	this->conf_SA_threads = fp.conf_SA_threads;
+	this->conf_SA_speculative_ops = fp.conf_SA_speculative_ops;
+	this->layout_journal = fp.layout_journal;
+	this->conf_SA_layout_cache_size = fp.conf_SA_layout_cache_size;
+	this->layout_cache = fp.layout_cache;
+	this->conf_SA_Pareto_archive_size = fp.conf_SA_Pareto_archive_size;
+	this->Pareto_archive = fp.Pareto_archive;
+	this->conf_SA_chains_weights = fp.conf_SA_chains_weights;
+	this->conf_SA_hierarchical_cluster_size = fp.conf_SA_hierarchical_cluster_size;
+	this->conf_SA_targeted_ops_ratio = fp.conf_SA_targeted_ops_ratio;
+	this->conf_SA_opt_thermal = fp.conf_SA_opt_thermal;
+	this->conf_SA_opt_interconnects = fp.conf_SA_opt_interconnects;
+	this->conf_SA_opt_alignment = fp.conf_SA_opt_alignment;
+	this->conf_SA_cost_thermal = fp.conf_SA_cost_thermal;
+	this->conf_SA_cost_WL = fp.conf_SA_cost_WL;
+	this->conf_SA_cost_TSVs = fp.conf_SA_cost_TSVs;
+	this->conf_SA_cost_alignment = fp.conf_SA_cost_alignment;
+	this->max_cost_thermal = fp.max_cost_thermal;
+	this->max_cost_WL = fp.max_cost_WL;
+	this->max_cost_alignments = fp.max_cost_alignments;
+	this->max_cost_TSVs = fp.max_cost_TSVs;
+	this->conf_SA_thermal_multi_resolution = fp.conf_SA_thermal_multi_resolution;
+	this->conf_SA_temp_init_factor = fp.conf_SA_temp_init_factor;
+	this->conf_SA_temp_factor_phase1 = fp.conf_SA_temp_factor_phase1;
+	this->conf_SA_temp_factor_phase1_limit = fp.conf_SA_temp_factor_phase1_limit;
+	this->conf_SA_temp_factor_phase2 = fp.conf_SA_temp_factor_phase2;
+	this->conf_SA_temp_factor_phase3 = fp.conf_SA_temp_factor_phase3;
+	this->tempSchedule = fp.tempSchedule;
+	this->conf_SA_layout_enhanced_hard_block_rotation = fp.conf_SA_layout_enhanced_hard_block_rotation;
+	this->conf_SA_layout_enhanced_soft_block_shaping = fp.conf_SA_layout_enhanced_soft_block_shaping;
+	this->conf_SA_layout_power_aware_block_handling = fp.conf_SA_layout_power_aware_block_handling;
+	this->conf_SA_layout_floorplacement = fp.conf_SA_layout_floorplacement;
+	this->conf_SA_layout_constructive_init = fp.conf_SA_layout_constructive_init;
+	this->conf_SA_layout_mincut_die_assignment = fp.conf_SA_layout_mincut_die_assignment;
+	this->conf_SA_layout_packing_iterations = fp.conf_SA_layout_packing_iterations;
+	this->last_op = fp.last_op;
+	this->last_op_die1 = fp.last_op_die1;
+	this->last_op_die2 = fp.last_op_die2;
+	this->last_op_tuple1 = fp.last_op_tuple1;
+	this->last_op_tuple2 = fp.last_op_tuple2;
+	this->last_op_juncts = fp.last_op_juncts;
+	this->blocks_power_density_stats = fp.blocks_power_density_stats;
+
+	// thermal analyzer
+	this->thermalAnalyzer = fp.thermalAnalyzer;
+	this->thermalAnalyzer_levels = fp.thermalAnalyzer_levels;
+	this->thermal_level = fp.thermal_level;
+	this->conf_power_blurring_parameters = fp.conf_power_blurring_parameters;
+	this->conf_power_blurring_thermal_map_dim = fp.conf_power_blurring_thermal_map_dim;
+	this->conf_power_blurring_thermal_mask_dim = fp.conf_power_blurring_thermal_mask_dim;
+	this->conf_power_blurring_single_precision = fp.conf_power_blurring_single_precision;
+	this->conf_power_blurring_TSV_density_masks = fp.conf_power_blurring_TSV_density_masks;
+
+	// thermal solver
+	this->thermalSolver = fp.thermalSolver;
+	this->conf_thermal_solver = fp.conf_thermal_solver;
+	this->fitting_iterations = fp.fitting_iterations;
+	this->tuning_configurations = fp.tuning_configurations;
+	this->tuning_runtime_weight = fp.tuning_runtime_weight;
+	this->tuning_configs = fp.tuning_configs;
+	this->tuning_best = fp.tuning_best;
+
+	for (ParetoSolution& sol : this->Pareto_archive) {
+		for (CornerBlockList& CBL : sol.CBLs) {
+			CBL.mapBlocks(this->blocks);
+		}
+	}
+
+	// each copy draws from its own random-number engine; seeded from the calling
+	// thread's engine
+	this->random_engine.seed(Math::randSeed());
+}
+
+FloorPlanner::~FloorPlanner() {
+}
+
+void FloorPlanner::initThermalAnalyzer() {
+	int level;
+	int map_dim, mask_dim;
+
+	// init resolution, i.e., dimensions of thermal maps and masks
+	this->thermalAnalyzer.initResolution(this->conf_power_blurring_thermal_map_dim, this->conf_power_blurring_thermal_mask_dim,
+			this->conf_power_blurring_single_precision);
+
+	// init sets of thermal masks
+	this->thermalAnalyzer.initThermalMasks(this->conf_layers, this->logMed(), this->conf_power_blurring_parameters,
+			this->conf_power_blurring_TSV_density_masks);
+
+	// init power maps, i.e. predetermine maps parameters
+	this->thermalAnalyzer.initPowerMaps(this->conf_layers, this->getOutline());
+
+	// init thermal analyzers for coarse resolutions, if required; ordered from
+	// coarsest to finest resolution
+	this->thermalAnalyzer_levels.clear();
+
+	if (this->conf_SA_thermal_multi_resolution) {
+
+		for (level = 0; level < FloorPlanner::SA_THERMAL_LEVELS; level++) {
+
+			ThermalAnalyzer::coarseResolution(this->conf_power_blurring_thermal_map_dim, this->conf_power_blurring_thermal_mask_dim,
+					FloorPlanner::SA_THERMAL_LEVELS_FACTOR[level], map_dim, mask_dim);
+
+			this->thermalAnalyzer_levels.emplace_back(ThermalAnalyzer());
+			this->thermalAnalyzer_levels.back().initResolution(map_dim, mask_dim, this->conf_power_blurring_single_precision);
+			this->thermalAnalyzer_levels.back().initThermalMasks(this->conf_layers, false, this->conf_power_blurring_parameters,
+					this->conf_power_blurring_TSV_density_masks);
+			this->thermalAnalyzer_levels.back().initPowerMaps(this->conf_layers, this->getOutline());
+
+			if (this->logMed()) {
+				cout << "ThermalAnalyzer> Multi-resolution thermal analysis; coarse level " << level << ": thermal-map dimension ";
+				cout << map_dim << ", thermal-mask dimension " << mask_dim << endl;
+			}
+		}
+	}
+
+	// apply full resolution by default
+	this->thermal_level = this->thermalAnalyzer_levels.size();
+}
+
+void FloorPlanner::updateThermalLevel(unsigned const& level, vector<CorblivarAlignmentReq> const& alignments, double const& fitting_layouts_ratio) {
+	Cost cost, cost_level;
+
+	if (level == this->thermal_level) {
+		return;
+	}
+
+	// renormalize max thermal cost, if already determined; the current layout's
+	// thermal cost is then the same for both resolutions, i.e., costs of
+	// layouts evaluated before and after the resolution change remain
+	// comparable
+	if (this->conf_SA_opt_thermal && this->max_cost_thermal > 0.0) {
+
+		cost = this->evaluateLayout(alignments, fitting_layouts_ratio, true);
+		this->thermal_level = level;
+		cost_level = this->evaluateLayout(alignments, fitting_layouts_ratio, true);
+		this->max_cost_thermal *= cost_level.thermal / cost.thermal;
+
+		// similarly, rescale the temperatures of archived solutions, such that
+		// they remain comparable to further solutions
+		for (ParetoSolution& sol : this->Pareto_archive) {
+			sol.cost.thermal_actual_value *= cost_level.thermal_actual_value / cost.thermal_actual_value;
+		}
+	}
+	else {
+		this->thermal_level = level;
+	}
+
+	if (this->logMed()) {
+		cout << "SA> Multi-resolution thermal analysis; applied thermal-map dimension: " << this->curThermalAnalyzer().getThermalMapDim() << endl;
+	}
+}
+
+void FloorPlanner::initThreadPool() {
+
+	// the calling thread is also processing tasks, thus one thread less is
+	// required for the pool
+	if (this->conf_SA_threads > 1) {
+		this->thread_pool.reset(new ThreadPool(this->conf_SA_threads - 1));
+	}
+}
+
+// init workers for parallel evaluation; each worker gets its own copy of the chip data
+// and CBLs
+void FloorPlanner::initSAWorkers(CorblivarCore const& corb) {
+	int w;
+
+	this->SA_workers_fp.clear();
+	this->SA_workers_corb.clear();
+	this->SA_workers_cost.clear();
+
+	for (w = 0; w < this->conf_SA_threads; w++) {
+
+		this->SA_workers_fp.emplace_back(new FloorPlanner(*this));
+		this->SA_workers_corb.emplace_back(new CorblivarCore(this->conf_layers, this->blocks.size()));
+
+		// workers shall not log
+		this->SA_workers_fp.back()->conf_log = 0;
+
+		// init layout state
+		this->initLayoutCopy(corb, *this->SA_workers_fp.back(), *this->SA_workers_corb.back());
+	}
+
+	this->SA_workers_cost.resize(this->conf_SA_threads);
+}
+
+// init copy of floorplanner and Corblivar core, as used by SA workers and chains; the
+// alignment requests are mapped to the copy's blocks
+void FloorPlanner::initLayoutCopy(CorblivarCore const& corb, FloorPlanner& fp, CorblivarCore& copy_corb) const {
+
+	// copy alignment requests; map blocks to copy's blocks
+	for (CorblivarAlignmentReq const& req : corb.getAlignments()) {
+
+		CorblivarAlignmentReq copy_req = req;
+
+		if (req.s_i->numerical_id == -1) {
+			copy_req.s_i = &fp.RBOD;
+		}
+		else {
+			copy_req.s_i = &fp.blocks[req.s_i->numerical_id];
+		}
+		if (req.s_j->numerical_id == -1) {
+			copy_req.s_j = &fp.RBOD;
+		}
+		else {
+			copy_req.s_j = &fp.blocks[req.s_j->numerical_id];
+		}
+
+		copy_corb.editAlignments().push_back(move(copy_req));
+	}
+
+	// init layout state
+	fp.copyLayoutState(*this, corb, copy_corb);
+}
+
+// copy whole layout state from other floorplanner and related Corblivar core, i.e.,
+// CBLs, block shapes and coordinates, alignment status, dies' outlines and max cost
+// values; the layout journal is reset to this state
+void FloorPlanner::copyLayoutState(FloorPlanner const& fp, CorblivarCore const& corb_source, CorblivarCore& corb) {
+	unsigned b, r;
+	int d;
+
+	for (b = 0; b < this->blocks.size(); b++) {
+		this->blocks[b].bb = fp.blocks[b].bb;
+		this->blocks[b].layer = fp.blocks[b].layer;
+		this->blocks[b].alignment = fp.blocks[b].alignment;
+	}
+
+	for (d = 0; d < this->conf_layers; d++) {
+		corb.copyCBL(corb_source, d, this->blocks);
+	}
+
+	for (r = 0; r < corb.getAlignments().size(); r++) {
+		corb.getAlignments()[r].fulfilled = corb_source.getAlignments()[r].fulfilled;
+	}
+
+	// the dies' outlines are required for the layout journal below, i.e.,
+	// they have to be copied beforehand
+	this->dies_outline = fp.dies_outline;
+
+	this->max_cost_thermal = fp.max_cost_thermal;
+	this->max_cost_WL = fp.max_cost_WL;
+	this->max_cost_alignments = fp.max_cost_alignments;
+	this->max_cost_TSVs = fp.max_cost_TSVs;
+	this->thermal_level = fp.thermal_level;
+
+	// the copied layout is the current layout
+	this->initLayoutJournal(corb);
+}
+
+// copy layout state only for the given dies and the blocks changed by the last
+// committed operation; sufficient in case the layouts differ only by this operation
+void FloorPlanner::copyLayoutState(FloorPlanner const& fp, CorblivarCore const& corb_source, CorblivarCore& corb, int const& die1, int const& die2) {
+	unsigned b, r;
+
+	for (int const& d : {die1, die2}) {
+
+		// die not affected by layout operation
+		if (d == -1 || (d == die2 && die1 == die2)) {
+			continue;
+		}
+
+		for (Block const* block : corb_source.getDie(d).getBlocks()) {
+			this->blocks[block->numerical_id].bb = block->bb;
+			this->blocks[block->numerical_id].layer = block->layer;
+
+			// the copied layout is the current layout
+			this->layout_journal.bbs[block->numerical_id] = block->bb;
+		}
+
+		corb.copyCBL(corb_source, d, this->blocks);
+	}
+
+	// the resulting layout may also differ for blocks on other dies, e.g., due to
+	// alignment of blocks across dies
+	for (int const& id : fp.layout_journal.changed) {
+		this->blocks[id].bb = this->layout_journal.bbs[id] = fp.blocks[id].bb;
+	}
+	for (b = 0; b < this->blocks.size(); b++) {
+		this->blocks[b].alignment = this->layout_journal.alignments[b] = fp.blocks[b].alignment;
+	}
+	for (r = 0; r < corb.getAlignments().size(); r++) {
+		corb.getAlignments()[r].fulfilled = this->layout_journal.alignments_fulfilled[r] = corb_source.getAlignments()[r].fulfilled;
+	}
+
+	this->dies_outline = this->layout_journal.dies_outline = fp.dies_outline;
+}
+
+void FloorPlanner::initLayoutJournal(CorblivarCore const& corb) {
+	unsigned b, r;
+
+	this->layout_journal.bbs.resize(this->blocks.size());
+	this->layout_journal.alignments.resize(this->blocks.size());
+	for (b = 0; b < this->blocks.size(); b++) {
+		this->layout_journal.bbs[b] = this->blocks[b].bb;
+		this->layout_journal.alignments[b] = this->blocks[b].alignment;
+	}
+
+	this->layout_journal.alignments_fulfilled.resize(corb.getAlignments().size());
+	for (r = 0; r < corb.getAlignments().size(); r++) {
+		this->layout_journal.alignments_fulfilled[r] = corb.getAlignments()[r].fulfilled;
+	}
+
+	this->layout_journal.dies_outline = this->dies_outline;
+}
+
+// note that the layout generation itself walks all blocks anyway; checking for
+// changed blocks is thus not limiting, but only changed blocks are rewritten
+void FloorPlanner::commitLayoutJournal(CorblivarCore const& corb) {
+	unsigned b, r;
+
+	this->layout_journal.changed.clear();
+
+	for (b = 0; b < this->blocks.size(); b++) {
+
+		Rect const& bb = this->blocks[b].bb;
+		Rect& bb_journal = this->layout_journal.bbs[b];
+
+		if (bb.ll.x != bb_journal.ll.x || bb.ll.y != bb_journal.ll.y || bb.w != bb_journal.w || bb.h != bb_journal.h) {
+			bb_journal = bb;
+			this->layout_journal.changed.push_back(b);
+		}
+		this->layout_journal.alignments[b] = this->blocks[b].alignment;
+	}
+
+	for (r = 0; r < corb.getAlignments().size(); r++) {
+		this->layout_journal.alignments_fulfilled[r] = corb.getAlignments()[r].fulfilled;
+	}
+
+	this->layout_journal.dies_outline = this->dies_outline;
+}
+
+// note that the CBLs and the blocks' shapes and layers are expected to be reverted
+// beforehand, see performRandomLayoutOp; only the resulting layout is restored here
+void FloorPlanner::revertLayoutJournal(CorblivarCore const& corb) {
+	unsigned b, r;
+
+	for (b = 0; b < this->blocks.size(); b++) {
+
+		Rect& bb = this->blocks[b].bb;
+		Rect const& bb_journal = this->layout_journal.bbs[b];
+
+		if (bb.ll.x != bb_journal.ll.x || bb.ll.y != bb_journal.ll.y || bb.w != bb_journal.w || bb.h != bb_journal.h) {
+			bb = bb_journal;
+		}
+		this->blocks[b].alignment = this->layout_journal.alignments[b];
+	}
+
+	for (r = 0; r < corb.getAlignments().size(); r++) {
+		corb.getAlignments()[r].fulfilled = this->layout_journal.alignments_fulfilled[r];
+	}
+
+	this->dies_outline = this->layout_journal.dies_outline;
+}
+
+// (re-)initialize the layout cache for the given temperature step; entries of
+// previous steps are implicitly invalidated. The blocks' shapes may have been
+// modified beyond layout operations, e.g., during initial sampling or phase
+// transition, thus the shapes' hash is redetermined here
+void FloorPlanner::initLayoutCache(int const& step) {
+
+	this->layout_cache.entries.resize(this->conf_SA_layout_cache_size);
+
+	// step 0 is reserved for unused entries
+	if (step == 1) {
+		for (LayoutCache::Entry& entry : this->layout_cache.entries) {
+			entry.step = 0;
+		}
+		this->layout_cache.lookups_total = this->layout_cache.hits_total = 0;
+	}
+
+	this->layout_cache.shapes_hash = 0;
+	for (Block const& block : this->blocks) {
+		this->layout_cache.shapes_hash ^= this->blockShapeHash(&block, block.bb);
+	}
+
+	this->layout_cache.lookups = this->layout_cache.hits = 0;
+}
+
+// note that the dies' hashes are memorized for unmodified CBLs, i.e., only the
+// dies modified by the last layout operation are to be rehashed
+unsigned long long FloorPlanner::layoutHash(CorblivarCore const& corb) const {
+	unsigned long long hash;
+	int d;
+
+	hash = this->layout_cache.shapes_hash;
+	for (d = 0; d < this->conf_layers; d++) {
+		hash ^= corb.getDie(d).getCBLHash();
+	}
+
+	return hash;
+}
+
+bool FloorPlanner::lookupLayoutCache(unsigned long long const& hash, int const& step, Cost& cost) {
+	LayoutCache::Entry const& entry = this->layout_cache.entries[hash % this->layout_cache.entries.size()];
+
+	this->layout_cache.lookups++;
+	this->layout_cache.lookups_total++;
+
+	if (entry.step == step && entry.hash == hash) {
+
+		cost = entry.cost;
+
+		this->layout_cache.hits++;
+		this->layout_cache.hits_total++;
+
+		return true;
+	}
+
+	return false;
+}
+
+// direct-mapped table; any previous entry is replaced
+void FloorPlanner::storeLayoutCache(unsigned long long const& hash, int const& step, Cost const& cost) {
+	LayoutCache::Entry& entry = this->layout_cache.entries[hash % this->layout_cache.entries.size()];
+
+	entry.hash = hash;
+	entry.step = step;
+	entry.cost = cost;
+}
+
+// the solution is added in case it's not dominated by (and not equal to) any archived
+// solution; archived solutions dominated by the new solution are dropped
+void FloorPlanner::updateParetoArchive(CorblivarCore const& corb, Cost const& cost, int const& step) {
+	unsigned s1, s2, drop;
+	double dist, min_dist, drop_dist;
+	array<double, 4> max_values;
+	vector< array<double, 4> > values;
+
+	for (ParetoSolution const& sol : this->Pareto_archive) {
+
+		if (FloorPlanner::dominates(sol.cost, cost)) {
+			return;
+		}
+
+		// same objective values; solution is already covered
+		if (sol.cost.HPWL_actual_value == cost.HPWL_actual_value
+				&& sol.cost.TSVs_actual_value == cost.TSVs_actual_value
+				&& sol.cost.thermal_actual_value == cost.thermal_actual_value
+				&& sol.cost.alignments_actual_value == cost.alignments_actual_value) {
+			return;
+		}
+	}
+
+	// drop solutions dominated by new solution
+	this->Pareto_archive.erase(
+			remove_if(this->Pareto_archive.begin(), this->Pareto_archive.end(), [&](ParetoSolution const& sol) {
+				return FloorPlanner::dominates(cost, sol.cost);
+			}),
+			this->Pareto_archive.end());
+
+	ParetoSolution sol;
+	sol.cost = cost;
+	for (int d = 0; d < this->conf_layers; d++) {
+		sol.CBLs.push_back(corb.getDie(d).getCBL());
+	}
+	for (Block const& block : this->blocks) {
+		sol.bbs.push_back(block.bb);
+	}
+	sol.step = step;
+	this->Pareto_archive.push_back(move(sol));
+
+	if (this->Pareto_archive.size() <= static_cast<unsigned>(this->conf_SA_Pareto_archive_size)) {
+		return;
+	}
+
+	// archive is full; normalize objective values by their max values
+	max_values.fill(0.0);
+	for (ParetoSolution const& sol : this->Pareto_archive) {
+		values.push_back({{sol.cost.HPWL_actual_value, static_cast<double>(sol.cost.TSVs_actual_value),
+				sol.cost.thermal_actual_value, sol.cost.alignments_actual_value}});
+
+		for (s1 = 0; s1 < max_values.size(); s1++) {
+			max_values[s1] = max(max_values[s1], values.back()[s1]);
+		}
+	}
+	for (array<double, 4>& v : values) {
+		for (s1 = 0; s1 < max_values.size(); s1++) {
+			if (max_values[s1] > 0.0) {
+				v[s1] /= max_values[s1];
+			}
+		}
+	}
+
+	// drop the solution w/ the nearest neighbor, i.e., the solution contributing
+	// the least to the spread of the archive
+	drop = 0;
+	drop_dist = numeric_limits<double>::max();
+	for (s1 = 0; s1 < values.size(); s1++) {
+
+		min_dist = numeric_limits<double>::max();
+		for (s2 = 0; s2 < values.size(); s2++) {
+
+			if (s1 == s2) {
+				continue;
+			}
+
+			dist = pow(values[s1][0] - values[s2][0], 2.0) + pow(values[s1][1] - values[s2][1], 2.0)
+				+ pow(values[s1][2] - values[s2][2], 2.0) + pow(values[s1][3] - values[s2][3], 2.0);
+			min_dist = min(min_dist, dist);
+		}
+
+		if (min_dist < drop_dist) {
+			drop_dist = min_dist;
+			drop = s1;
+		}
+	}
+
+	this->Pareto_archive.erase(this->Pareto_archive.begin() + drop);
+}
+
+// the archived solutions are reevaluated w/ all cost terms and the final thermal
+// resolution; solutions then dominated by others are dropped. Note that the best
+// solution is to be applied afterwards
+void FloorPlanner::finalizeParetoArchive(CorblivarCore& corb) {
+	unsigned b, s1, s2;
+	int d;
+	vector<bool> dominated;
+
+	for (ParetoSolution& sol : this->Pareto_archive) {
+
+		// apply CBLs and blocks' shapes of solution
+		for (d = 0; d < this->conf_layers; d++) {
+
+			corb.editDie(d).editCBL() = sol.CBLs[d];
+
+			for (Block const* block : corb.getDie(d).getBlocks()) {
+				block->layer = d;
+			}
+		}
+		for (b = 0; b < this->blocks.size(); b++) {
+			this->blocks[b].bb = sol.bbs[b];
+		}
+
+		this->generateLayout(corb, this->conf_SA_opt_alignment);
+		sol.cost = this->evaluateLayout(corb.getAlignments(), 1.0, true, false, true);
+		sol.solution = corb.CBLsString();
+	}
+
+	// determine dominated solutions first, then drop them
+	dominated.resize(this->Pareto_archive.size(), false);
+	for (s1 = 0; s1 < this->Pareto_archive.size(); s1++) {
+		for (s2 = 0; s2 < this->Pareto_archive.size(); s2++) {
+
+			if (FloorPlanner::dominates(this->Pareto_archive[s2].cost, this->Pareto_archive[s1].cost)) {
+				dominated[s1] = true;
+				break;
+			}
+		}
+	}
+	for (s1 = this->Pareto_archive.size(); s1 > 0; s1--) {
+		if (dominated[s1 - 1]) {
+			this->Pareto_archive.erase(this->Pareto_archive.begin() + (s1 - 1));
+		}
+	}
+}
+
+// the chains are forked from the current layout; each chain gets its own copy of the
+// chip data and CBLs, along w/ its cost factors
+void FloorPlanner::initSAChains(CorblivarCore const& corb) {
+
+	this->SA_chains.clear();
+
+	for (array<double, 4> const& weights : this->conf_SA_chains_weights) {
+
+		SAChain chain;
+		chain.fp.reset(new FloorPlanner(*this));
+		chain.corb.reset(new CorblivarCore(this->conf_layers, this->blocks.size()));
+
+		// chains shall not log
+		chain.fp->conf_log = 0;
+
+		// cost factors of chain; note that the optimization flags are shared,
+		// i.e., the cost terms required by any chain are evaluated for all
+		// chains, see IO::parseParametersFiles
+		chain.fp->conf_SA_cost_thermal = weights[0];
+		chain.fp->conf_SA_cost_WL = weights[1];
+		chain.fp->conf_SA_cost_TSVs = weights[2];
+		chain.fp->conf_SA_cost_alignment = weights[3];
+
+		// init layout state
+		this->initLayoutCopy(corb, *chain.fp, *chain.corb);
+
+		chain.best_cost = numeric_limits<double>::max();
+		chain.valid_layout_found = false;
+		// the forked layout fits into the outline; the chain's actual fitting
+		// ratio is determined after its first step
+		chain.fitting_layouts_ratio = 1.0;
+		chain.accepted_ops = chain.layout_fit_counter = 0;
+		chain.evaluations = chain.shared = 0;
+
+		this->SA_chains.push_back(move(chain));
+	}
+
+	if (this->logMed()) {
+		cout << "SA> Multi-weight chains; fork " << this->SA_chains.size() << " further chains from current layout" << endl;
+	}
+}
+
+// init chains for temperature step; the chains' normalization of cost terms is to be
+// synced w/ the main floorplanner, which is required for sharing the cost terms via the
+// layout cache
+void FloorPlanner::initSAChainsStep(int const& step) {
+	LayoutEvaluation evaluate_layout;
+	bool share;
+
+	evaluate_layout = this->specializedLayoutEvaluation(true);
+
+	// costs are not shared for block-alignment optimization, see performSA
+	share = !this->conf_SA_opt_alignment;
+
+	for (SAChain& chain : this->SA_chains) {
+
+		// determine chain's fitting ratio of previous step; fixed during the
+		// step, as for the main SA loop
+		if (chain.accepted_ops > 0) {
+			chain.fitting_layouts_ratio = static_cast<double>(chain.layout_fit_counter) / chain.accepted_ops;
+		}
+		chain.accepted_ops = chain.layout_fit_counter = 0;
+
+		// update max cost values and thermal resolution; these may have been
+		// renormalized for the step
+		chain.fp->max_cost_thermal = this->max_cost_thermal;
+		chain.fp->max_cost_WL = this->max_cost_WL;
+		chain.fp->max_cost_alignments = this->max_cost_alignments;
+		chain.fp->max_cost_TSVs = this->max_cost_TSVs;
+		chain.fp->thermal_level = this->thermal_level;
+
+		// redetermine shapes' hash, required for sharing costs
+		chain.fp->initLayoutCache(step);
+
+		// init cost for current layout; shared if possible
+		chain.hash = chain.fp->layoutHash(*chain.corb);
+		if (share && this->lookupLayoutCache(chain.hash, step, chain.cost)) {
+
+			chain.fp->weightCost(chain.cost, chain.fitting_layouts_ratio);
+			chain.shared++;
+		}
+		else {
+			chain.cost = (chain.fp.get()->*evaluate_layout)(chain.corb->getAlignments(), chain.fitting_layouts_ratio, false);
+			if (share) {
+				this->storeLayoutCache(chain.hash, step, chain.cost);
+			}
+			chain.evaluations++;
+		}
+		chain.cur_cost = chain.cost.total_cost;
+
+		// memorize current layout
+		chain.fp->initLayoutJournal(*chain.corb);
+	}
+}
+
+// one layout op for each chain; the chains share the temperature of the main SA loop.
+// The layouts are looked up in the layout cache first; only layouts not yet evaluated
+// during the current step, by the main loop or any chain, are generated and evaluated,
+// in parallel if possible. The costs are weighted w/ the chain's cost factors and
+// fitting ratio. For block-alignment optimization, costs are not shared, see performSA
+void FloorPlanner::performSAChainsLayoutOps(int const& step, double const& cur_temp) {
+	unsigned c;
+	vector<unsigned> evaluate;
+	double cost_diff;
+	double r;
+	LayoutEvaluation evaluate_layout;
+	bool share;
+
+	share = !this->conf_SA_opt_alignment;
+
+	// perform random layout ops; performed sequentially in order to maintain one
+	// stream of random numbers
+	for (c = 0; c < this->SA_chains.size(); c++) {
+
+		SAChain& chain = this->SA_chains[c];
+
+		while (!chain.fp->performRandomLayoutOp(*chain.corb, true)) {
+		}
+
+		// lookup cost of layout in cache
+		chain.hash = chain.fp->layoutHash(*chain.corb);
+		chain.cached = share && this->lookupLayoutCache(chain.hash, step, chain.cost);
+
+		if (chain.cached) {
+			chain.fp->weightCost(chain.cost, chain.fitting_layouts_ratio);
+			chain.shared++;
+		}
+		else {
+			evaluate.push_back(c);
+			chain.evaluations++;
+		}
+	}
+
+	// generate and evaluate remaining layouts; the chains share the optimization
+	// flags, thus also the specialized layout evaluation
+	evaluate_layout = this->specializedLayoutEvaluation(true);
+	function<void(unsigned const&)> evaluate_chain = [&](unsigned const& e) {
+
+		SAChain& chain = this->SA_chains[evaluate[e]];
+		Math::RandomEngineScope random_scope(chain.fp->random_engine);
+
+		chain.fp->generateLayout(*chain.corb, this->conf_SA_opt_alignment);
+		chain.cost = (chain.fp.get()->*evaluate_layout)(chain.corb->getAlignments(), chain.fitting_layouts_ratio, false);
+	};
+
+	if (this->thread_pool != nullptr) {
+		this->thread_pool->run(evaluate.size(), evaluate_chain);
+	}
+	else {
+		for (c = 0; c < evaluate.size(); c++) {
+			evaluate_chain(c);
+		}
+	}
+
+	// share costs of evaluated layouts
+	if (share) {
+		for (unsigned const& e : evaluate) {
+			this->storeLayoutCache(this->SA_chains[e].hash, step, this->SA_chains[e].cost);
+		}
+	}
+
+	// apply Metropolis criterion for each chain
+	for (SAChain& chain : this->SA_chains) {
+
+		cost_diff = chain.cost.total_cost - chain.cur_cost;
+
+		if (cost_diff >= 0.0) {
+			r = Math::randF(0, 1);
+			if (r > exp(- cost_diff / cur_temp)) {
+
+				// revert last op and related layout; cached layouts
+				// are not generated
+				chain.fp->performRandomLayoutOp(*chain.corb, true, true);
+				if (!chain.cached) {
+					chain.fp->revertLayoutJournal(*chain.corb);
+				}
+
+				continue;
+			}
+		}
+
+		// accepted op w/ cached cost; the layout is yet to be generated, and
+		// to be evaluated as well since the evaluation also annotates the
+		// layout, e.g., the TSVs. The fresh cost is considered from now on
+		if (chain.cached) {
+			chain.fp->generateLayout(*chain.corb, this->conf_SA_opt_alignment);
+			chain.cost = (chain.fp.get()->*evaluate_layout)(chain.corb->getAlignments(), chain.fitting_layouts_ratio, false);
+		}
+
+		chain.fp->commitLayoutJournal(*chain.corb);
+		chain.cur_cost = chain.cost.total_cost;
+		chain.accepted_ops++;
+
+		if (chain.cost.fits_fixed_outline) {
+
+			chain.layout_fit_counter++;
+
+			// memorize best solution which fits into outline; consider
+			// cost terms w/ fitting ratio 1.0, as for the main SA loop
+			if (chain.cost.total_cost_fitting < chain.best_cost) {
+
+				chain.best_cost = chain.cost.total_cost_fitting;
+				chain.corb->storeBestCBLs();
+				chain.valid_layout_found = true;
+			}
+		}
+	}
+}
+
+// the chains' best solutions are reevaluated w/ all cost terms and the final thermal
+// resolution
+void FloorPlanner::finalizeSAChains() {
+
+	for (SAChain& chain : this->SA_chains) {
+
+		if (!chain.valid_layout_found) {
+			continue;
+		}
+
+		chain.fp->max_cost_thermal = this->max_cost_thermal;
+		chain.fp->max_cost_WL = this->max_cost_WL;
+		chain.fp->max_cost_alignments = this->max_cost_alignments;
+		chain.fp->max_cost_TSVs = this->max_cost_TSVs;
+		chain.fp->thermal_level = chain.fp->thermalAnalyzer_levels.size();
+
+		chain.corb->applyBestCBLs(false);
+		chain.fp->generateLayout(*chain.corb, this->conf_SA_opt_alignment);
+		chain.cost = chain.fp->evaluateLayout(chain.corb->getAlignments(), 1.0, true, false, true);
+		chain.solution = chain.corb->CBLsString();
+	}
+}
+
+// speculative, parallel evaluation of layout operations: each worker performs one
+// random layout operation on its copy of the current layout; the resulting layouts
+// are generated and evaluated in parallel; the candidates are then considered
+// sequentially w/ the Metropolis criterion, i.e., the first accepted operation is
+// applied and all further operations are discarded. Since rejected operations do not
+// alter the current layout, this maintains the statistics of the sequential SA.
+bool FloorPlanner::performSpeculativeLayoutOps(CorblivarCore& corb, bool const& SA_phase_two, double const& fitting_layouts_ratio,
+		double const& cur_temp, double const& cur_cost, int& ii, int const& innerLoopMax, Cost& cost) {
+	unsigned w, workers;
+	int accepted;
+	double cost_diff;
+	double r;
+	LayoutEvaluation evaluate_layout;
+
+	workers = this->SA_workers_fp.size();
+
+	// update max cost values; these may have been reset during phase transition
+	for (w = 0; w < workers; w++) {
+		this->SA_workers_fp[w]->max_cost_thermal = this->max_cost_thermal;
+		this->SA_workers_fp[w]->max_cost_WL = this->max_cost_WL;
+		this->SA_workers_fp[w]->max_cost_alignments = this->max_cost_alignments;
+		this->SA_workers_fp[w]->max_cost_TSVs = this->max_cost_TSVs;
+		this->SA_workers_fp[w]->thermal_level = this->thermal_level;
+	}
+
+	// perform random layout ops on workers; performed sequentially in order to
+	// maintain one stream of random numbers
+	for (w = 0; w < workers; w++) {
+		while (!this->SA_workers_fp[w]->performRandomLayoutOp(*this->SA_workers_corb[w], SA_phase_two)) {
+		}
+	}
+
+	// generate and evaluate layouts in parallel; the workers share the config,
+	// thus also the specialized layout evaluation
+	evaluate_layout = this->specializedLayoutEvaluation(SA_phase_two);
+	this->thread_pool->run(workers, [&](unsigned const& worker) {
+		Math::RandomEngineScope random_scope(this->SA_workers_fp[worker]->random_engine);
+
+		this->SA_workers_fp[worker]->generateLayout(*this->SA_workers_corb[worker], this->conf_SA_opt_alignment && SA_phase_two);
+		this->SA_workers_cost[worker] = (this->SA_workers_fp[worker].get()->*evaluate_layout)(
+				this->SA_workers_corb[worker]->getAlignments(), fitting_layouts_ratio, false);
+	});
+
+	// consider candidates in order, apply Metropolis criterion
+	accepted = -1;
+	for (w = 0; w < workers && ii <= innerLoopMax; w++) {
+
+		cost_diff = this->SA_workers_cost[w].total_cost - cur_cost;
+
+		if (FloorPlanner::DBG_SA) {
+			cout << "DBG_SA> Inner step: " << ii << "/" << innerLoopMax << " (speculative op " << w << ")" << endl;
+			cout << "DBG_SA> Cost diff: " << cost_diff << endl;
+		}
+
+		if (cost_diff >= 0.0) {
+			r = Math::randF(0, 1);
+			if (r > exp(- cost_diff / cur_temp)) {
+
+				// rejected op is only counted; next op to be considered
+				ii++;
+
+				continue;
+			}
+		}
+
+		// first accepted op
+		accepted = w;
+		break;
+	}
+
+	// revert all ops except the accepted one; also revert the related layouts
+	for (w = 0; w < workers; w++) {
+		if (static_cast<int>(w) != accepted) {
+			this->SA_workers_fp[w]->performRandomLayoutOp(*this->SA_workers_corb[w], SA_phase_two, true);
+			this->SA_workers_fp[w]->revertLayoutJournal(*this->SA_workers_corb[w]);
+		}
+		else {
+			this->SA_workers_fp[w]->commitLayoutJournal(*this->SA_workers_corb[w]);
+		}
+	}
+
+	// no op accepted; all workers are now again in sync w/ the current layout
+	if (accepted == -1) {
+		return false;
+	}
+
+	FloorPlanner& fp_accepted = *this->SA_workers_fp[accepted];
+	CorblivarCore& corb_accepted = *this->SA_workers_corb[accepted];
+
+	// apply accepted layout as current layout
+	this->copyLayoutState(fp_accepted, corb_accepted, corb);
+	this->last_op = fp_accepted.last_op;
+	cost = this->SA_workers_cost[accepted];
+
+	// sync other workers; they differ only for the dies and the changed blocks of
+	// the accepted op
+	for (w = 0; w < workers; w++) {
+		if (static_cast<int>(w) != accepted) {
+			this->SA_workers_fp[w]->copyLayoutState(fp_accepted, corb_accepted, *this->SA_workers_corb[w],
+					fp_accepted.last_op_die1, fp_accepted.last_op_die2);
+		}
+	}
+
+	return true;
+}
 
 // main handler
+void FloorPlanner::initCorblivar(CorblivarCore& corb) const {
+	bool layers_assigned;
+
+	// min-cut assignment of blocks to dies, if desired; not applicable for
+	// power-aware block handling which requires a specific assignment
+	layers_assigned = this->conf_SA_layout_mincut_die_assignment && !this->conf_SA_layout_power_aware_block_handling;
+	if (layers_assigned) {
+		Partitioner::partition(this->blocks, this->nets, this->conf_layers, this->logMed());
+	}
+
+	// generate new data set; constructively or randomly
+	if (this->conf_SA_layout_constructive_init) {
+		corb.initCorblivarConstructively(this->logMed(), this->conf_layers, this->blocks, this->conf_SA_layout_power_aware_block_handling, this->getOutline(), layers_assigned);
+	}
+	else {
+		corb.initCorblivarRandomly(this->logMed(), this->conf_layers, this->blocks, this->conf_SA_layout_power_aware_block_handling, layers_assigned);
+	}
+}
+
+// block-to-net index; note that nets are redefined for hierarchical floorplanning,
+// thus the index is initialized for each SA run, see performSA
+void FloorPlanner::initBlocksNets() {
+
+	this->blocks_nets.assign(this->blocks.size(), vector<unsigned>());
+
+	for (unsigned n = 0; n < this->nets.size(); n++) {
+		for (Block const* b : this->nets[n].blocks) {
+			this->blocks_nets[b->numerical_id].push_back(n);
+		}
+	}
+}
+
+// hierarchical floorplanning: blocks are assigned to dies and clustered by connectivity
+// within each die; the clusters are floorplanned as soft blocks within their die, and
+// the blocks of each cluster are then floorplanned within the region of their
+// cluster. Note that alignment requests and thermal optimization are not supported,
+// see IO::parseBlocks
+bool FloorPlanner::performHierarchicalSA(CorblivarCore& corb) {
+	int clusters, clusters_per_layer;
+	unsigned b;
+	int i;
+	vector<int> blocks_cluster, clusters_die, clusters_layer, dies;
+	vector< vector<int> > clusters_blocks, dies_clusters;
+	vector<Rect> dies_outline, clusters_region;
+	vector<Point> dies_extent;
+	double scale_x, scale_y;
+	double area, width_max, height_max;
+	bool scaling_valid;
+	bool success;
+
+	if (FloorPlanner::DBG_CALLS_SA) {
+		cout << "-> FloorPlanner::performHierarchicalSA(" << &corb << ")" << endl;
+	}
+
+	// fall back to flat floorplanning; the hierarchical mode is disabled, such that
+	// the layout is subsequently handled as regular one, see Corblivar.cpp
+	function<bool(string const&)> fallback = [&](string const& reason) {
+
+		if (this->logMin()) {
+			cout << "SA> Hierarchical floorplanning; " << reason << "; falling back to flat floorplanning ..." << endl;
+			cout << endl;
+		}
+
+		this->conf_SA_hierarchical_cluster_size = 0;
+
+		this->initCorblivar(corb);
+		return this->performSA(corb);
+	};
+
+	// assign blocks to dies by min-cut partitioning; subsequently cluster blocks
+	// by connectivity within each die
+	Partitioner::partition(this->blocks, this->nets, this->conf_layers, this->logMed());
+
+	clusters_per_layer = static_cast<int>(ceil(static_cast<double>(this->blocks.size()) / (this->conf_SA_hierarchical_cluster_size * this->conf_layers)));
+
+	if (this->logMed()) {
+		cout << "SA> Hierarchical floorplanning; clustering of " << this->blocks.size() << " blocks into " << clusters_per_layer * this->conf_layers << " clusters ..." << endl;
+	}
+
+	blocks_cluster = Partitioner::cluster(this->blocks, this->nets, this->conf_layers, clusters_per_layer);
+
+	clusters_blocks.resize(clusters_per_layer * this->conf_layers);
+	for (b = 0; b < this->blocks.size(); b++) {
+		clusters_blocks[blocks_cluster[b]].push_back(b);
+	}
+
+	// drop empty clusters, if any; update blocks' clusters accordingly
+	clusters_blocks.erase(remove_if(clusters_blocks.begin(), clusters_blocks.end(),
+				[](vector<int> const& cluster_blocks) {
+					return cluster_blocks.empty();
+				}),
+			clusters_blocks.end());
+	clusters = clusters_blocks.size();
+
+	for (int c = 0; c < clusters; c++) {
+		for (int const& block : clusters_blocks[c]) {
+			blocks_cluster[block] = c;
+		}
+	}
+
+	/// top level: floorplanning of clusters within their dies
+	//
+	FloorPlanner top(*this);
+	this->initClustersFloorPlanner(top, clusters_blocks);
+
+	dies_clusters.resize(this->conf_layers);
+	for (Block const& cluster : top.blocks) {
+		dies_clusters[cluster.layer].push_back(cluster.numerical_id);
+		clusters_die.push_back(cluster.layer);
+	}
+	for (i = 0; i < this->conf_layers; i++) {
+
+		Rect outline;
+		outline.ll.x = outline.ll.y = 0.0;
+		outline.ur.x = outline.w = this->conf_outline_x;
+		outline.ur.y = outline.h = this->conf_outline_y;
+		outline.area = this->die_area;
+
+		dies_outline.push_back(outline);
+		dies.push_back(i);
+	}
+
+	if (this->logMed()) {
+		cout << "SA> Hierarchical floorplanning; floorplanning of clusters within dies ..." << endl;
+	}
+
+	success = this->performRegionsSA(top, dies_clusters, clusters_die, dies_outline, dies, "die");
+
+	if (!success && this->logMin()) {
+		cout << "SA> Hierarchical floorplanning; clusters cannot be fit into all dies, their layouts are scaled into the dies" << endl;
+		cout << endl;
+	}
+
+	// clusters are soft blocks; their layouts are scaled such that they span the
+	// whole die, i.e., the slack reserved for the die level (see
+	// SA_HIERARCHICAL_TOP_UTILIZATION) is passed on to the clusters as
+	// whitespace. Layouts exceeding their die are scaled down into the die
+	// outline, i.e., the clusters' whitespace is reduced accordingly
+	dies_extent.resize(this->conf_layers);
+	for (Block const& cluster : top.blocks) {
+		dies_extent[cluster.layer].x = max(dies_extent[cluster.layer].x, cluster.bb.ur.x);
+		dies_extent[cluster.layer].y = max(dies_extent[cluster.layer].y, cluster.bb.ur.y);
+	}
+	scaling_valid = true;
+	for (Block const& cluster : top.blocks) {
+
+		scale_x = this->conf_outline_x / dies_extent[cluster.layer].x;
+		scale_y = this->conf_outline_y / dies_extent[cluster.layer].y;
+
+		cluster.bb.ll.x *= scale_x;
+		cluster.bb.ur.x *= scale_x;
+		cluster.bb.ll.y *= scale_y;
+		cluster.bb.ur.y *= scale_y;
+		cluster.bb.w = cluster.bb.ur.x - cluster.bb.ll.x;
+		cluster.bb.h = cluster.bb.ur.y - cluster.bb.ll.y;
+		cluster.bb.area = cluster.bb.w * cluster.bb.h;
+
+		// the scaled region has to cover its blocks' area and its widest and
+		// highest block; otherwise the blocks cannot be fit
+		area = width_max = height_max = 0.0;
+		for (int const& block : clusters_blocks[cluster.numerical_id]) {
+			area += this->blocks[block].bb.area;
+			width_max = max(width_max, this->blocks[block].bb.w);
+			height_max = max(height_max, this->blocks[block].bb.h);
+		}
+		if (cluster.bb.area < area || cluster.bb.w < width_max || cluster.bb.h < height_max) {
+			scaling_valid = false;
+		}
+	}
+
+	if (!scaling_valid) {
+		success = fallback("scaled clusters cannot cover their blocks");
+
+		if (FloorPlanner::DBG_CALLS_SA) {
+			cout << "<- FloorPlanner::performHierarchicalSA : " << success << endl;
+		}
+
+		return success;
+	}
+
+	/// cluster level: floorplanning of blocks within clusters' regions
+	//
+	for (Block const& cluster : top.blocks) {
+		clusters_region.push_back(cluster.bb);
+		clusters_layer.push_back(cluster.layer);
+	}
+
+	if (this->logMed()) {
+		cout << "SA> Hierarchical floorplanning; floorplanning of blocks within clusters ..." << endl;
+	}
+
+	success = this->performRegionsSA(*this, clusters_blocks, blocks_cluster, clusters_region, clusters_layer, "cluster");
+
+	// blocks not fitting into their cluster's region may overlap w/ other
+	// clusters or exceed the die outline
+	if (!success) {
+		success = fallback("blocks cannot be fit into all clusters");
+	}
+	else if (this->logMed()) {
+		cout << "SA> Hierarchical floorplanning; done" << endl;
+		cout << endl;
+	}
+
+	if (FloorPlanner::DBG_CALLS_SA) {
+		cout << "<- FloorPlanner::performHierarchicalSA : " << success << endl;
+	}
+
+	return success;
+}
+
+// init top-level floorplanner, i.e., represent each cluster as soft block
+void FloorPlanner::initClustersFloorPlanner(FloorPlanner& top, vector< vector<int> > const& clusters_blocks) const {
+	double whitespace_factor;
+	double area, power, width_max, height_max;
+	double AR_lower, AR_upper;
+	vector<double> layers_blocks_area;
+	vector<int> blocks_cluster;
+	vector<int> net_clusters;
+	unsigned c;
+
+	top.blocks.clear();
+	top.nets.clear();
+	top.TSVs.clear();
+
+	// clusters are soft blocks; guided shaping enables dense packing of clusters
+	top.conf_SA_layout_enhanced_soft_block_shaping = true;
+	top.conf_SA_layout_floorplacement = false;
+
+	// whitespace to be reserved within clusters, separately for each die; the
+	// clusters shall utilize the dies as defined, the remaining deadspace is
+	// reserved within the clusters
+	layers_blocks_area.resize(this->conf_layers, 0.0);
+	for (Block const& block : this->blocks) {
+		layers_blocks_area[block.layer] += block.bb.area;
+	}
+
+	top.blocks_area = 0.0;
+	top.blocks_power_density_stats.max = top.blocks_power_density_stats.avg = 0.0;
+	top.blocks_power_density_stats.min = -1;
+
+	blocks_cluster.resize(this->blocks.size());
+
+	for (c = 0; c < clusters_blocks.size(); c++) {
+
+		Block cluster("cluster_" + to_string(c + 1));
+		cluster.numerical_id = c;
+		cluster.soft = true;
+		// clusters are defined within one layer
+		cluster.layer = this->blocks[clusters_blocks[c].front()].layer;
+
+		area = power = width_max = height_max = 0.0;
+		for (int const& b : clusters_blocks[c]) {
+
+			area += this->blocks[b].bb.area;
+			power += this->blocks[b].power_density * this->blocks[b].bb.area;
+			width_max = max(width_max, this->blocks[b].bb.w);
+			height_max = max(height_max, this->blocks[b].bb.h);
+
+			blocks_cluster[b] = c;
+		}
+
+		// the region has to cover the largest block
+		whitespace_factor = max(1.0, FloorPlanner::SA_HIERARCHICAL_TOP_UTILIZATION * this->die_area / layers_blocks_area[cluster.layer]);
+		cluster.bb.area = max(area * whitespace_factor, width_max * height_max);
+		cluster.power_density = power / cluster.bb.area;
+
+		// AR range; limited such that the widest and the highest block fit
+		// into the region
+		AR_lower = pow(width_max, 2.0) / cluster.bb.area;
+		AR_upper = cluster.bb.area / pow(height_max, 2.0);
+		cluster.AR.min = min(max(AR_lower, FloorPlanner::SA_HIERARCHICAL_CLUSTER_AR_MIN), AR_upper);
+		cluster.AR.max = max(min(AR_upper, FloorPlanner::SA_HIERARCHICAL_CLUSTER_AR_MAX), cluster.AR.min);
+
+		cluster.shapeRandomlyByAR();
+
+		top.blocks.push_back(cluster);
+
+		top.blocks_area += cluster.bb.area;
+		top.blocks_power_density_stats.max = max(top.blocks_power_density_stats.max, cluster.power_density);
+		if (top.blocks_power_density_stats.min == -1) {
+			top.blocks_power_density_stats.min = cluster.power_density;
+		}
+		top.blocks_power_density_stats.min = min(top.blocks_power_density_stats.min, cluster.power_density);
+		top.blocks_power_density_stats.avg += cluster.power_density;
+	}
+
+	top.blocks_power_density_stats.avg /= top.blocks.size();
+	top.blocks_power_density_stats.range = top.blocks_power_density_stats.max - top.blocks_power_density_stats.min;
+	top.stack_deadspace = top.stack_area - top.blocks_area;
+
+	// derive nets among clusters; nets within one cluster are not relevant
+	for (Net const& net : this->nets) {
+
+		net_clusters.clear();
+		for (Block const* b : net.blocks) {
+			net_clusters.push_back(blocks_cluster[b->numerical_id]);
+		}
+		sort(net_clusters.begin(), net_clusters.end());
+		net_clusters.erase(unique(net_clusters.begin(), net_clusters.end()), net_clusters.end());
+
+		if (net_clusters.empty() || (net_clusters.size() == 1 && net.terminals.empty())) {
+			continue;
+		}
+
+		Net cluster_net(net.id);
+		cluster_net.hasExternalPin = net.hasExternalPin;
+
+		for (int const& cl : net_clusters) {
+			cluster_net.blocks.push_back(&top.blocks[cl]);
+		}
+		for (Pin const* pin : net.terminals) {
+			cluster_net.terminals.push_back(&top.terminals[pin->numerical_id]);
+		}
+		cluster_net.initTerminalsBoundingBox();
+
+		top.nets.push_back(cluster_net);
+	}
+}
+
+// floorplanning of blocks of given floorplanner within their regions; regions are
+// handled independently, thus in parallel if desired. The resulting layouts are
+// memorized in the given floorplanner's blocks
+bool FloorPlanner::performRegionsSA(FloorPlanner const& fp, vector< vector<int> > const& regions_blocks, vector<int> const& blocks_region,
+		vector<Rect> const& regions, vector<int> const& regions_layer, string const& regions_name) const {
+	vector<int> regions_success;
+	vector< vector<Rect> > regions_bbs;
+	vector<unsigned> regions_seed;
+	unsigned b;
+	bool success;
+
+	regions_success.resize(regions.size(), 0);
+	regions_bbs.resize(regions.size());
+
+	// each region draws from its own random-number engine, independent of the
+	// thread processing it; seeds are drawn beforehand
+	for (unsigned r = 0; r < regions.size(); r++) {
+		regions_seed.push_back(Math::randSeed());
+	}
+
+	function<void(unsigned const&)> region_task = [&](unsigned const& r) {
+		Math::RandomEngine random_engine(regions_seed[r]);
+		Math::RandomEngineScope random_scope(random_engine);
+
+		regions_success[r] = fp.performRegionSA(regions_blocks[r], blocks_region, regions, r, regions_bbs[r]);
+	};
+
+	if (this->thread_pool != nullptr) {
+		this->thread_pool->run(regions.size(), region_task);
+	}
+	else {
+		for (unsigned r = 0; r < regions.size(); r++) {
+			region_task(r);
+		}
+	}
+
+	// merge regions' layouts; note that the layouts are not directly applied
+	// during floorplanning since other regions are handled concurrently and are
+	// copying the blocks
+	success = true;
+	for (unsigned r = 0; r < regions.size(); r++) {
+
+		for (b = 0; b < regions_blocks[r].size(); b++) {
+
+			Block const& block = fp.blocks[regions_blocks[r][b]];
+
+			block.bb = regions_bbs[r][b];
+			block.layer = regions_layer[r];
+		}
+
+		success = success && (regions_success[r] == 1);
+
+		if (this->logMed()) {
+			cout << "SA> Hierarchical floorplanning;  " << regions_name << " " << r + 1 << " (" << regions_blocks[r].size() << " blocks) on layer " << regions_layer[r] + 1;
+			cout << "; fitting into region: " << regions_success[r] << endl;
+		}
+	}
+
+	if (this->logMed()) {
+		cout << endl;
+	}
+
+	return success;
+}
+
+// floorplanning of one region's blocks within the region, using a floorplanner for
+// one die w/ the region as outline; the resulting blocks' bounding boxes are returned
+// by reference
+bool FloorPlanner::performRegionSA(vector<int> const& region_blocks, vector<int> const& blocks_region, vector<Rect> const& regions, int const& region,
+		vector<Rect>& region_bbs) const {
+	Rect const& outline = regions[region];
+	FloorPlanner fp(*this);
+	vector<int> local_block;
+	vector<int> relevant_nets, nets_pin;
+	Rect ext;
+	bool has_block, has_ext;
+	double x, y;
+	unsigned b, n;
+	bool success;
+
+	fp.blocks.clear();
+	fp.terminals.clear();
+	fp.nets.clear();
+	fp.TSVs.clear();
+
+	// region floorplanners shall not log
+	fp.conf_log = 0;
+
+	// floorplanning is limited to one layer, i.e., the region; TSVs are thus not
+	// relevant. Note that thermal optimization and alignments are not supported
+	// for hierarchical floorplanning, see IO::parseBlocks
+	fp.conf_layers = 1;
+	fp.conf_outline_x = outline.w;
+	fp.conf_outline_y = outline.h;
+	fp.die_AR = fp.conf_outline_x / fp.conf_outline_y;
+	fp.die_area = fp.stack_area = outline.area;
+	fp.conf_SA_cost_TSVs = 0.0;
+	fp.conf_SA_layout_mincut_die_assignment = false;
+
+	// copy region's blocks, w/ local ids
+	local_block.resize(this->blocks.size(), -1);
+	fp.blocks_area = 0.0;
+	for (b = 0; b < region_blocks.size(); b++) {
+
+		fp.blocks.push_back(this->blocks[region_blocks[b]]);
+		fp.blocks.back().numerical_id = b;
+		fp.blocks.back().layer = 0;
+		fp.blocks_area += fp.blocks.back().bb.area;
+
+		local_block[region_blocks[b]] = b;
+	}
+	fp.stack_deadspace = fp.stack_area - fp.blocks_area;
+
+	// regions' blocks are few; consider more operations per temperature step,
+	// also w/ a lower bound for the operations
+	fp.conf_SA_loopFactor = max(fp.conf_SA_loopFactor, FloorPlanner::SA_HIERARCHICAL_LOOP_FACTOR);
+	if (fp.blocks.size() > 1) {
+		fp.conf_SA_loopFactor = max(fp.conf_SA_loopFactor, log(FloorPlanner::SA_HIERARCHICAL_MIN_OPS) / log(fp.blocks.size()));
+	}
+
+	// external connections of nets, i.e., to blocks in other regions and to
+	// terminal pins, are represented by pseudo pins; these pins are placed at the
+	// center of the external connections, clamped to the region. Blocks in other
+	// regions are considered by the center of their region
+	for (n = 0; n < this->nets.size(); n++) {
+
+		Net const& net = this->nets[n];
+
+		has_block = has_ext = false;
+		ext.ll.x = ext.ll.y = numeric_limits<double>::max();
+		ext.ur.x = ext.ur.y = -numeric_limits<double>::max();
+
+		for (Block const* block : net.blocks) {
+
+			if (blocks_region[block->numerical_id] == region) {
+				has_block = true;
+			}
+			else {
+				Rect const& other = regions[blocks_region[block->numerical_id]];
+
+				has_ext = true;
+				x = other.ll.x + other.w / 2.0;
+				y = other.ll.y + other.h / 2.0;
+				ext.ll.x = min(ext.ll.x, x);
+				ext.ll.y = min(ext.ll.y, y);
+				ext.ur.x = max(ext.ur.x, x);
+				ext.ur.y = max(ext.ur.y, y);
+			}
+		}
+		for (Pin const* pin : net.terminals) {
+
+			has_ext = true;
+			ext.ll.x = min(ext.ll.x, pin->bb.ll.x);
+			ext.ll.y = min(ext.ll.y, pin->bb.ll.y);
+			ext.ur.x = max(ext.ur.x, pin->bb.ll.x);
+			ext.ur.y = max(ext.ur.y, pin->bb.ll.y);
+		}
+
+		if (!has_block) {
+			continue;
+		}
+
+		relevant_nets.push_back(n);
+
+		if (has_ext) {
+
+			Pin pin("region_pin_" + to_string(net.id));
+			pin.numerical_id = fp.terminals.size();
+
+			// clamp to region; coordinates relative to region
+			x = min(max((ext.ll.x + ext.ur.x) / 2.0, outline.ll.x), outline.ur.x);
+			y = min(max((ext.ll.y + ext.ur.y) / 2.0, outline.ll.y), outline.ur.y);
+			pin.bb.ll.x = pin.bb.ur.x = x - outline.ll.x;
+			pin.bb.ll.y = pin.bb.ur.y = y - outline.ll.y;
+
+			nets_pin.push_back(pin.numerical_id);
+			fp.terminals.push_back(pin);
+		}
+		else {
+			nets_pin.push_back(-1);
+		}
+	}
+
+	// derive nets; only after all pins are memorized, i.e., the pins' vector is not
+	// reallocated anymore
+	for (n = 0; n < relevant_nets.size(); n++) {
+
+		Net const& net = this->nets[relevant_nets[n]];
+		Net region_net(net.id);
+		region_net.hasExternalPin = (nets_pin[n] != -1);
+
+		for (Block const* block : net.blocks) {
+			if (local_block[block->numerical_id] != -1) {
+				region_net.blocks.push_back(&fp.blocks[local_block[block->numerical_id]]);
+			}
+		}
+		if (nets_pin[n] != -1) {
+			region_net.terminals.push_back(&fp.terminals[nets_pin[n]]);
+		}
+
+		// nets w/ only one block and w/o pin are not relevant
+		if (region_net.blocks.size() + region_net.terminals.size() < 2) {
+			continue;
+		}
+
+		region_net.initTerminalsBoundingBox();
+		fp.nets.push_back(region_net);
+	}
+
+	// floorplanning of region; restart SA for layouts not fitting into the region
+	CorblivarCore corb(1, fp.blocks.size());
+	success = false;
+	for (int trial = 0; trial < FloorPlanner::SA_HIERARCHICAL_TRIALS && !success; trial++) {
+		fp.initCorblivar(corb);
+		success = fp.performSA(corb);
+	}
+
+	// apply best solution, if available, and generate related layout; note that
+	// best solutions are only available for fitting layouts, otherwise the
+	// current CBLs are considered
+	if (success) {
+		corb.applyBestCBLs(false);
+	}
+	fp.generateLayout(corb, false);
+
+	// memorize layout, shifted into region
+	region_bbs.clear();
+	for (Block const& block : fp.blocks) {
+
+		region_bbs.push_back(block.bb);
+		region_bbs.back().ll.x += outline.ll.x;
+		region_bbs.back().ur.x += outline.ll.x;
+		region_bbs.back().ll.y += outline.ll.y;
+		region_bbs.back().ur.y += outline.ll.y;
+	}
+
+	return success;
+}
+
 bool FloorPlanner::performSA(CorblivarCore& corb) {
 	int i, ii;
 	int innerLoopMax;
@@ -46,7 +1559,7 @@ bool FloorPlanner::performSA(CorblivarCore& corb) {
 	double cur_cost, best_cost, prev_cost, cost_diff, avg_cost, fitting_cost;
 	Cost cost;
 	vector<double> cost_samples;
-	double cur_temp, init_temp;
+	double cur_temp, init_temp, phase_two_temp;
 	double r;
 	int layout_fit_counter;
 	double fitting_layouts_ratio;
@@ -56,6 +1569,16 @@ bool FloorPlanner::performSA(CorblivarCore& corb) {
 	bool accept;
 	bool SA_phase_two, SA_phase_two_init;
 	bool valid_layout;
+	bool regenerate_layout;
+	bool layout_cache, cached;
+	unsigned long long layout_hash;
+	int steps_wo_best_sol;
+	vector<double> prev_avg_cost;
+	double std_dev_avg_cost;
+	unsigned s, w;
+	unsigned level;
+	bool speculative_ops;
+	LayoutEvaluation evaluate_layout;
 
 	if (FloorPlanner::DBG_CALLS_SA) {
 		cout << "-> FloorPlanner::performSA(" << &corb << ")" << endl;
@@ -67,24 +1590,79 @@ bool FloorPlanner::performSA(CorblivarCore& corb) {
 	//
 	// also, for random layout operations in SA phase one, these blocks are not
 	// allowed to be swapped or moved, see performOpMoveOrSwapBlocks
-	if (this->conf_SA_layout_floorplacement) {
+	//
+	// note that the constructive initialization already places large blocks first;
+	// sorting would thus only break up the constructed layout
+	if (this->conf_SA_layout_floorplacement && !this->conf_SA_layout_constructive_init) {
 		corb.sortCBLs(this->logMed(), CorblivarCore::SORT_CBLS_BY_BLOCKS_SIZE);
 	}
 
+	// init block-to-net index for targeted layout operations; to be done before
+	// the workers are initialized, which copy the index
+	if (this->conf_SA_targeted_ops_ratio > 0.0) {
+		this->initBlocksNets();
+	}
+
+	// init workers for parallel processing, i.e., parallel initial sampling and,
+	// if desired, speculative evaluation of layout operations
+	if (this->thread_pool != nullptr) {
+		this->initSAWorkers(corb);
+	}
+
 	// init SA: initial sampling; setup parameters, setup temperature schedule
 	this->initSA(corb, cost_samples, innerLoopMax, init_temp);
 
+	// speculative ops are not applied along w/ multi-weight chains, where the
+	// thread pool is used for the chains' evaluation instead
+	speculative_ops = this->conf_SA_speculative_ops && this->thread_pool != nullptr && this->conf_SA_chains_weights.empty();
+	if (speculative_ops) {
+
+		if (this->logMed()) {
+			cout << "SA> Speculative, parallel evaluation of layout operations; worker threads: " << this->thread_pool->threads() << endl;
+		}
+	}
+
+	// layout cache; applied only for the sequential evaluation of layout ops. Not
+	// applied for block-alignment optimization, since the cache is keyed only by
+	// the CBLs and the blocks' shapes, whereas the layouts and the alignments'
+	// status also depend on the alignment handling during layout generation
+	layout_cache = this->conf_SA_layout_cache_size > 0 && !speculative_ops && !this->conf_SA_opt_alignment;
+	if (layout_cache) {
+
+		if (this->logMed()) {
+			cout << "SA> Layout cache; max entries: " << this->conf_SA_layout_cache_size << endl;
+		}
+	}
+	else if (this->conf_SA_layout_cache_size > 0 && this->conf_SA_opt_alignment) {
+
+		if (this->logMed()) {
+			cout << "SA> Layout cache; not applied for block-alignment optimization" << endl;
+		}
+	}
+	layout_hash = 0;
+
 	/// main SA loop
 	//
 	// init loop parameters
 	i = 1;
-	cur_temp = init_temp;
+	cur_temp = phase_two_temp = init_temp;
 	SA_phase_two = SA_phase_two_init = false;
 	valid_layout_found = false;
 	i_valid_layout_found = Point::UNDEF;
 	fitting_layouts_ratio = 0.0;
-	// dummy large value to accept first fitting solution
-	best_cost = 100.0 * Math::stdDev(cost_samples);
+	// dummy large value to accept first fitting solution; note that a value
+	// derived from the initial sampling is not sufficient for initial layouts
+	// already close to the outline, where the sampled costs hardly differ
+	best_cost = numeric_limits<double>::max();
+	steps_wo_best_sol = 0;
+	this->SA_early_termination_step = Point::UNDEF;
+	// the layout is generated initially; afterwards, the current layout is
+	// maintained via the layout journal, see below
+	regenerate_layout = true;
+	// layout evaluation, specialized for the current SA phase
+	evaluate_layout = this->specializedLayoutEvaluation(SA_phase_two);
+	this->Pareto_archive.clear();
+	this->SA_chains.clear();
 
 	/// outer loop: annealing -- temperature steps
 	while (i <= this->conf_SA_loopLimit) {
@@ -101,41 +1679,128 @@ bool FloorPlanner::performSA(CorblivarCore& corb) {
 		SA_phase_two_init = false;
 		best_sol_found = false;
 
-		// init cost for current layout and fitting ratio
-		this->generateLayout(corb, this->conf_SA_opt_alignment && SA_phase_two);
-		cur_cost = this->evaluateLayout(corb.getAlignments(), fitting_layouts_ratio, SA_phase_two).total_cost;
+		// init cost for current layout and fitting ratio; the layout itself has
+		// only to be regenerated initially and after the phase transition, i.e.,
+		// when block alignment is to be considered from now on
+		if (regenerate_layout) {
+			this->generateLayout(corb, this->conf_SA_opt_alignment && SA_phase_two);
+			regenerate_layout = false;
+		}
+
+		// multi-resolution thermal analysis; refine the resolution as the
+		// temperature drops below the levels' limits; the resolution is never
+		// coarsened again, also not for reheating
+		if (SA_phase_two && this->conf_SA_opt_thermal) {
+
+			level = this->thermal_level;
+			while (level < this->thermalAnalyzer_levels.size() && cur_temp <= phase_two_temp * FloorPlanner::SA_THERMAL_LEVELS_TEMP[level]) {
+				level++;
+			}
+
+			this->updateThermalLevel(level, corb.getAlignments(), fitting_layouts_ratio);
+		}
+
+		cost = (this->*evaluate_layout)(corb.getAlignments(), fitting_layouts_ratio, false);
+		cur_cost = cost.total_cost;
+
+		// memorize current layout
+		this->initLayoutJournal(corb);
+
+		// init layout cache for current step; also memorize the cost of the
+		// current layout, which is revisited by reverse layout ops
+		if (layout_cache) {
+			this->initLayoutCache(i);
+			this->storeLayoutCache(this->layoutHash(corb), i, cost);
+		}
+
+		// multi-weight chains; forked from the current layout once phase two is
+		// reached, and synced w/ the cost function for each step
+		if (SA_phase_two && !this->conf_SA_chains_weights.empty()) {
+
+			if (this->SA_chains.empty()) {
+				this->initSAChains(corb);
+			}
+			this->initSAChainsStep(i);
+		}
+
+		// sync workers w/ current layout
+		if (speculative_ops) {
+			for (w = 0; w < this->SA_workers_fp.size(); w++) {
+				this->SA_workers_fp[w]->copyLayoutState(*this, corb, *this->SA_workers_corb[w]);
+			}
+		}
 
 		// inner loop: layout operations
 		while (ii <= innerLoopMax) {
 
-			// perform random layout op
-			op_success = this->performRandomLayoutOp(corb, SA_phase_two);
+			// speculative, parallel evaluation of multiple layout ops; note that
+			// rejected candidate ops are already accounted for in ii
+			if (speculative_ops) {
+
+				op_success = this->performSpeculativeLayoutOps(corb, SA_phase_two, fitting_layouts_ratio, cur_temp, cur_cost, ii, innerLoopMax, cost);
+
+				// no candidate op accepted
+				if (!op_success) {
+					continue;
+				}
+
+				cur_cost = cost.total_cost;
+				accept = true;
+			}
+			// sequential evaluation of one layout op
+			else {
+				// perform random layout op
+				op_success = this->performRandomLayoutOp(corb, SA_phase_two);
 
-			if (op_success) {
+				if (!op_success) {
+					continue;
+				}
 
 				prev_cost = cur_cost;
 
-				// generate layout; also memorize whether layout is valid;
-				// note that this return value is only effective if
-				// CorblivarCore::DBG_VALID_LAYOUT is set
-				valid_layout = this->generateLayout(corb, this->conf_SA_opt_alignment && SA_phase_two);
+				// lookup cost of layout in cache; for repeated layouts,
+				// the layout generation and evaluation is skipped
+				cached = false;
+				if (layout_cache) {
+					layout_hash = this->layoutHash(corb);
+					cached = this->lookupLayoutCache(layout_hash, i, cost);
+
+					// costs may be shared by multi-weight chains, thus
+					// they are to be weighted w/ own cost factors
+					if (cached && !this->SA_chains.empty()) {
+						this->weightCost(cost, fitting_layouts_ratio);
+					}
+				}
+
+				if (!cached) {
+
+					// generate layout; also memorize whether layout is valid;
+					// note that this return value is only effective if
+					// CorblivarCore::DBG_VALID_LAYOUT is set
+					valid_layout = this->generateLayout(corb, this->conf_SA_opt_alignment && SA_phase_two);
+
+					// dbg invalid layouts
+					if (CorblivarCore::DBG_VALID_LAYOUT && !valid_layout) {
+
+						// generate invalid floorplan for dbg
+						IO::writeFloorplanGP(*this, corb.getAlignments(), "invalid_layout");
+						// generate related Corblivar solution
+						if (this->solution_out.is_open()) {
+							this->solution_out << corb.CBLsString() << endl;
+							this->solution_out.close();
+						}
+						// abort further run
+						exit(1);
+					}
 
-				// dbg invalid layouts
-				if (CorblivarCore::DBG_VALID_LAYOUT && !valid_layout) {
+					// evaluate layout, new cost
+					cost = (this->*evaluate_layout)(corb.getAlignments(), fitting_layouts_ratio, false);
 
-					// generate invalid floorplan for dbg
-					IO::writeFloorplanGP(*this, corb.getAlignments(), "invalid_layout");
-					// generate related Corblivar solution
-					if (this->solution_out.is_open()) {
-						this->solution_out << corb.CBLsString() << endl;
-						this->solution_out.close();
+					if (layout_cache) {
+						this->storeLayoutCache(layout_hash, i, cost);
 					}
-					// abort further run
-					exit(1);
 				}
 
-				// evaluate layout, new cost
-				cost = this->evaluateLayout(corb.getAlignments(), fitting_layouts_ratio, SA_phase_two);
 				cur_cost = cost.total_cost;
 				// cost difference
 				cost_diff = cur_cost - prev_cost;
@@ -158,81 +1823,120 @@ bool FloorPlanner::performSA(CorblivarCore& corb) {
 
 						// revert last op
 						this->performRandomLayoutOp(corb, SA_phase_two, true);
+						// revert related layout; not required for
+						// cached layouts, which are not generated
+						if (!cached) {
+							this->revertLayoutJournal(corb);
+						}
 						// reset cost according to reverted CBL
 						cur_cost = prev_cost;
 					}
-				}
+				}
+
+				// accepted op w/ cached cost; the layout is yet to be
+				// generated, and to be evaluated as well since the
+				// evaluation also annotates the layout, e.g., the TSVs.
+				// The fresh cost is considered from now on
+				if (accept && cached) {
+					this->generateLayout(corb, this->conf_SA_opt_alignment && SA_phase_two);
+					cost = (this->*evaluate_layout)(corb.getAlignments(), fitting_layouts_ratio, false);
+					cur_cost = cost.total_cost;
+				}
+			}
+
+			// solution to be accepted, i.e., previously not reverted
+			if (accept) {
+				// update ops count
+				accepted_ops++;
+				// sum up cost for subsequent avg determination
+				avg_cost += cur_cost;
+
+				if (cost.fits_fixed_outline) {
+					// update count of solutions fitting into outline
+					layout_fit_counter++;
+
+					// switch to SA phase two when
+					// first fitting solution is found
+					if (!SA_phase_two) {
+
+						// switch phase
+						SA_phase_two = SA_phase_two_init = true;
+						evaluate_layout = this->specializedLayoutEvaluation(SA_phase_two);
+						// memorize related temperature; required
+						// for multi-resolution thermal analysis
+						phase_two_temp = cur_temp;
+
+						// re-calculate cost for new
+						// phase; assume fitting ratio 1.0
+						// for initialization and for
+						// effective comparison of further
+						// fitting solutions; also
+						// initialize all max cost terms
+						fitting_cost = this->evaluateLayout(corb.getAlignments(), 1.0, true, true).total_cost;
+
+						// also memorize in which
+						// iteration we found the first
+						// valid layout
+						i_valid_layout_found = i;
+
+						// logging
+						if (this->logMax()) {
+							cout << "SA> " << endl;
+						}
+						if (this->logMed()) {
+							cout << "SA> Phase II: optimizing within outline; switch cost function ..." << endl;
+						}
+						if (this->logMax()) {
+							cout << "SA> " << endl;
+						}
+					}
+					// not first but any fitting solution; in
+					// order to compare different fitting
+					// solutions equally, consider cost terms
+					// w/ fitting ratio 1.0
+					else {
+						fitting_cost = cost.total_cost_fitting;
 
-				// solution to be accepted, i.e., previously not reverted
-				if (accept) {
-					// update ops count
-					accepted_ops++;
-					// sum up cost for subsequent avg determination
-					avg_cost += cur_cost;
-
-					if (cost.fits_fixed_outline) {
-						// update count of solutions fitting into outline
-						layout_fit_counter++;
-
-						// switch to SA phase two when
-						// first fitting solution is found
-						if (!SA_phase_two) {
-
-							// switch phase
-							SA_phase_two = SA_phase_two_init = true;
-
-							// re-calculate cost for new
-							// phase; assume fitting ratio 1.0
-							// for initialization and for
-							// effective comparison of further
-							// fitting solutions; also
-							// initialize all max cost terms
-							fitting_cost = this->evaluateLayout(corb.getAlignments(), 1.0, true, true).total_cost;
-
-							// also memorize in which
-							// iteration we found the first
-							// valid layout
-							i_valid_layout_found = i;
-
-							// logging
-							if (this->logMax()) {
-								cout << "SA> " << endl;
-							}
-							if (this->logMed()) {
-								cout << "SA> Phase II: optimizing within outline; switch cost function ..." << endl;
-							}
-							if (this->logMax()) {
-								cout << "SA> " << endl;
-							}
-						}
-						// not first but any fitting solution; in
-						// order to compare different fitting
-						// solutions equally, consider cost terms
-						// w/ fitting ratio 1.0
-						else {
-							fitting_cost = cost.total_cost_fitting;
+						// memorize in Pareto archive, if
+						// not dominated
+						if (this->conf_SA_Pareto_archive_size > 0) {
+							this->updateParetoArchive(corb, cost, i);
 						}
+					}
 
-						// memorize best solution which fits into outline
-						if (fitting_cost < best_cost) {
+					// memorize best solution which fits into outline
+					if (fitting_cost < best_cost) {
 
-							best_cost = fitting_cost;
-							corb.storeBestCBLs();
-							valid_layout_found = best_sol_found = true;
-						}
+						best_cost = fitting_cost;
+						corb.storeBestCBLs();
+						valid_layout_found = best_sol_found = true;
 					}
 				}
 
-				// after phase transition, skip current global iteration
-				// in order to consider updated cost function
-				if (SA_phase_two_init) {
-					break;
-				}
-				// consider next loop iteration
-				else {
-					ii++;
+				// memorize layout of accepted op as current layout;
+				// for speculative ops, this is already covered by
+				// syncing w/ the accepted worker
+				if (!speculative_ops) {
+					this->commitLayoutJournal(corb);
 				}
 			}
+
+			// one layout op for each multi-weight chain, in lockstep w/
+			// the main loop
+			if (!this->SA_chains.empty()) {
+				this->performSAChainsLayoutOps(i, cur_temp);
+			}
+
+			// after phase transition, skip current global iteration
+			// in order to consider updated cost function
+			if (SA_phase_two_init) {
+				regenerate_layout = true;
+				break;
+			}
+			// consider next loop iteration
+			else {
+				ii++;
+			}
 		}
 
 		// determine ratio of solutions fitting into outline in current temp step;
@@ -258,6 +1962,9 @@ bool FloorPlanner::performSA(CorblivarCore& corb) {
 			cout << "SA>  new best solution found: " << best_sol_found << endl;
 			cout << "SA>  accept-ops ratio: " << accepted_ops_ratio << endl;
 			cout << "SA>  valid-layouts ratio: " << fitting_layouts_ratio << endl;
+			if (layout_cache && this->layout_cache.lookups > 0) {
+				cout << "SA>  layout-cache hit rate: " << static_cast<double>(this->layout_cache.hits) / this->layout_cache.lookups << endl;
+			}
 			cout << "SA>  avg cost: " << avg_cost << endl;
 			cout << "SA>  temp: " << cur_temp << endl;
 		}
@@ -271,6 +1978,44 @@ bool FloorPlanner::performSA(CorblivarCore& corb) {
 		cur_step.cost_best_sol = best_cost;
 		this->tempSchedule.push_back(move(cur_step));
 
+		// convergence-based early termination; only applicable once fitting
+		// solutions are found, i.e., the run shall not be terminated before
+		// any valid solution is available
+		if (this->conf_SA_early_termination_steps > 0 && valid_layout_found) {
+
+			if (best_sol_found) {
+				steps_wo_best_sol = 0;
+			}
+			else {
+				steps_wo_best_sol++;
+			}
+
+			// no new best solution for the last steps; check whether the
+			// avg cost of these steps has converged as well
+			if (steps_wo_best_sol >= this->conf_SA_early_termination_steps) {
+
+				prev_avg_cost.clear();
+				for (s = 1; s <= static_cast<unsigned>(this->conf_SA_early_termination_steps); s++) {
+					prev_avg_cost.push_back(this->tempSchedule[this->tempSchedule.size() - s].avg_cost);
+				}
+				std_dev_avg_cost = Math::stdDev(prev_avg_cost);
+
+				if (std_dev_avg_cost <= this->conf_SA_early_termination_std_dev) {
+
+					this->SA_early_termination_step = i;
+
+					if (this->logMed()) {
+						cout << "SA> Early termination in step " << i << "/" << this->conf_SA_loopLimit;
+						cout << "; no new best solution for " << steps_wo_best_sol << " steps and std dev of avg cost (";
+						cout << std_dev_avg_cost << ") below limit (" << this->conf_SA_early_termination_std_dev << ")" << endl;
+						cout << "SA> Saved steps: " << this->conf_SA_loopLimit - i << endl;
+					}
+
+					break;
+				}
+			}
+		}
+
 		// update SA temperature
 		this->updateTemp(cur_temp, i, i_valid_layout_found);
 
@@ -278,7 +2023,22 @@ bool FloorPlanner::performSA(CorblivarCore& corb) {
 		i++;
 	}
 
+	// multi-resolution thermal analysis; apply full resolution for
+	// finalization; the max thermal cost is renormalized for the last layout
+	if (this->thermal_level != this->thermalAnalyzer_levels.size()) {
+
+		this->generateLayout(corb, this->conf_SA_opt_alignment && SA_phase_two);
+		this->updateThermalLevel(this->thermalAnalyzer_levels.size(), corb.getAlignments(), fitting_layouts_ratio);
+	}
+
 	if (this->logMed()) {
+		if (layout_cache && this->layout_cache.lookups_total > 0) {
+			cout << "SA> Layout cache; overall hit rate: " << static_cast<double>(this->layout_cache.hits_total) / this->layout_cache.lookups_total << endl;
+		}
+		for (s = 0; s < this->SA_chains.size(); s++) {
+			cout << "SA> Multi-weight chain " << s + 1 << "; valid layout found: " << this->SA_chains[s].valid_layout_found;
+			cout << "; layouts evaluated: " << this->SA_chains[s].evaluations << ", shared via layout cache: " << this->SA_chains[s].shared << endl;
+		}
 		cout << "SA> Done" << endl;
 		cout << endl;
 	}
@@ -353,10 +2113,9 @@ void FloorPlanner::updateTemp(double& cur_temp, int const& iteration, int const&
 }
 
 void FloorPlanner::initSA(CorblivarCore& corb, vector<double>& cost_samples, int& innerLoopMax, double& init_temp) {
-	int i;
-	int accepted_ops;
-	bool op_success;
-	double cur_cost, prev_cost, cost_diff;
+	int ops;
+	unsigned w, walks;
+	vector< vector<double> > walks_cost_samples;
 
 	// reset max cost
 	this->max_cost_WL = 0.0;
@@ -364,6 +2123,10 @@ void FloorPlanner::initSA(CorblivarCore& corb, vector<double>& cost_samples, int
 	this->max_cost_thermal = 0.0;
 	this->max_cost_alignments = 0.0;
 
+	// multi-resolution thermal analysis; start w/ coarsest resolution, if
+	// available
+	this->thermal_level = 0;
+
 	// reset temperature-schedule log
 	this->tempSchedule.clear();
 
@@ -379,19 +2142,72 @@ void FloorPlanner::initSA(CorblivarCore& corb, vector<double>& cost_samples, int
 		cout << "SA> Perform initial solution-space sampling..." << endl;
 	}
 
-	// init cost; ignore alignment here
-	this->generateLayout(corb, false);
-	cur_cost = this->evaluateLayout(corb.getAlignments()).total_cost;
-
 	// perform some random operations, for SA temperature = 0.0
 	// i.e., consider only solutions w/ improved cost
 	// track acceptance ratio and cost (phase one, area and AR mismatch)
 	// also trigger cost function to assume no fitting layouts
+	ops = SA_SAMPLING_LOOP_FACTOR * static_cast<int>(this->blocks.size());
+	cost_samples.reserve(ops);
+
+	// parallel sampling: independent, shorter walks on workers, each starting
+	// from the initial layout; cost samples of all walks are merged. Note that
+	// each walk draws from its worker's random-number engine
+	if (!this->SA_workers_fp.empty()) {
+
+		walks = this->SA_workers_fp.size();
+		walks_cost_samples.resize(walks);
+
+		this->thread_pool->run(walks, [&](unsigned const& walk) {
+			Math::RandomEngineScope random_scope(this->SA_workers_fp[walk]->random_engine);
+
+			this->SA_workers_fp[walk]->performSampling(*this->SA_workers_corb[walk], (ops + walks - 1) / walks, walks_cost_samples[walk]);
+		});
+
+		for (w = 0; w < walks; w++) {
+			cost_samples.insert(cost_samples.end(), walks_cost_samples[w].begin(), walks_cost_samples[w].end());
+
+			// reset workers' layout to initial layout
+			this->SA_workers_fp[w]->copyLayoutState(*this, corb, *this->SA_workers_corb[w]);
+		}
+	}
+	// sequential sampling
+	else {
+		this->performSampling(corb, ops, cost_samples);
+	}
+
+	// init SA parameter: start temp, depends on std dev of costs [Huan86, see
+	// Shahookar91]
+	init_temp = Math::stdDev(cost_samples) * this->conf_SA_temp_init_factor;
+
+	if (this->logMed()) {
+		cout << "SA> Done; std dev of cost: " << Math::stdDev(cost_samples) << ", initial temperature: " << init_temp << endl;
+		cout << "SA> " << endl;
+		cout << "SA> Perform simulated annealing process..." << endl;
+		cout << "SA> Phase I: packing blocks into outline..." << endl;
+		cout << "SA> " << endl;
+	}
+
+	// restore initial CBLs
+	corb.restoreCBLs();
+}
+
+// sampling walk: perform random layout operations, accept only improving ones and
+// memorize the resulting costs
+void FloorPlanner::performSampling(CorblivarCore& corb, int const& ops, vector<double>& cost_samples) {
+	int i;
+	int accepted_ops;
+	bool op_success;
+	double cur_cost, prev_cost, cost_diff;
+
+	// init cost; ignore alignment here
+	this->generateLayout(corb, false);
+	cur_cost = this->evaluateLayout(corb.getAlignments()).total_cost;
+
 	i = 1;
 	accepted_ops = 0;
-	cost_samples.reserve(SA_SAMPLING_LOOP_FACTOR * this->blocks.size());
+	cost_samples.reserve(cost_samples.size() + ops);
 
-	while (i <= SA_SAMPLING_LOOP_FACTOR * static_cast<int>(this->blocks.size())) {
+	while (i <= ops) {
 
 		op_success = this->performRandomLayoutOp(corb);
 
@@ -424,21 +2240,6 @@ void FloorPlanner::initSA(CorblivarCore& corb, vector<double>& cost_samples, int
 			i++;
 		}
 	}
-
-	// init SA parameter: start temp, depends on std dev of costs [Huan86, see
-	// Shahookar91]
-	init_temp = Math::stdDev(cost_samples) * this->conf_SA_temp_init_factor;
-
-	if (this->logMed()) {
-		cout << "SA> Done; std dev of cost: " << Math::stdDev(cost_samples) << ", initial temperature: " << init_temp << endl;
-		cout << "SA> " << endl;
-		cout << "SA> Perform simulated annealing process..." << endl;
-		cout << "SA> Phase I: packing blocks into outline..." << endl;
-		cout << "SA> " << endl;
-	}
-
-	// restore initial CBLs
-	corb.restoreCBLs();
 }
 
 void FloorPlanner::finalize(CorblivarCore& corb, bool const& determ_overall_cost, bool const& handle_corblivar) {
@@ -447,6 +2248,11 @@ void FloorPlanner::finalize(CorblivarCore& corb, bool const& determ_overall_cost
 	bool valid_solution;
 	double x, y;
 	Cost cost;
+	ThermalSolver::Result thermal_solver_result;
+	bool thermal_solver;
+	ThermalAnalyzer::Temp temp_double_precision;
+	double max_deviation_double_precision = 0.0;
+	int map_x, map_y;
 
 	if (FloorPlanner::DBG_CALLS_SA) {
 		cout << "-> FloorPlanner::finalize(" << &corb << ", " << determ_overall_cost << ", " << handle_corblivar << ")" << endl;
@@ -454,6 +2260,15 @@ void FloorPlanner::finalize(CorblivarCore& corb, bool const& determ_overall_cost
 
 	// consider as regular Corblivar run
 	if (handle_corblivar) {
+		// reevaluate Pareto archive, if any
+		if (!this->Pareto_archive.empty()) {
+			this->finalizeParetoArchive(corb);
+		}
+		// reevaluate best solutions of multi-weight chains, if any
+		if (!this->SA_chains.empty()) {
+			this->finalizeSAChains();
+		}
+
 		// apply best solution, if available, as final solution
 		valid_solution = corb.applyBestCBLs(this->logMin());
 		// generate final layout
@@ -463,12 +2278,18 @@ void FloorPlanner::finalize(CorblivarCore& corb, bool const& determ_overall_cost
 	// determine final cost, also for non-Corblivar calls
 	if (!handle_corblivar || valid_solution) {
 
+		// for non-Corblivar calls, the dies' outline has to be determined
+		// from the blocks directly
+		if (!handle_corblivar) {
+			this->determDiesOutline();
+		}
+
 		// determine overall blocks outline; reasonable die outline for whole
 		// 3D-IC stack
 		x = y = 0.0;
-		for (Block const& b : this->blocks) {
-			x = max(x, b.bb.ur.x);
-			y = max(y, b.bb.ur.y);
+		for (Point const& outline : this->dies_outline) {
+			x = max(x, outline.x);
+			y = max(y, outline.y);
 		}
 
 		// shrink fixed outline considering the final layout
@@ -480,6 +2301,34 @@ void FloorPlanner::finalize(CorblivarCore& corb, bool const& determ_overall_cost
 		// determine cost terms and overall cost
 		cost = this->evaluateLayout(corb.getAlignments(), 1.0, true, false, true);
 
+		// accuracy of single-precision power blurring; repeat the power
+		// blurring for the final power maps in double precision
+		if (this->conf_power_blurring_single_precision && this->power_density_file_avail) {
+
+			ThermalAnalyzer analyzer_double_precision = this->thermalAnalyzer;
+			analyzer_double_precision.initResolution(this->conf_power_blurring_thermal_map_dim, this->conf_power_blurring_thermal_mask_dim, false);
+			analyzer_double_precision.performPowerBlurring(temp_double_precision, this->conf_layers, this->conf_power_blurring_parameters);
+
+			for (map_x = 0; map_x < this->conf_power_blurring_thermal_map_dim; map_x++) {
+				for (map_y = 0; map_y < this->conf_power_blurring_thermal_map_dim; map_y++) {
+					max_deviation_double_precision = max(max_deviation_double_precision,
+							abs(this->thermalAnalyzer.getThermalMap()[map_x][map_y] - analyzer_double_precision.getThermalMap()[map_x][map_y]));
+				}
+			}
+		}
+
+		// grid-based thermal analysis, as reference for the thermal analysis
+		// based on power blurring; requires the TSV densities of the final
+		// power maps. For thermal-analysis fitting runs, one common TSV
+		// density is considered, similar to the HotSpot files
+		thermal_solver = this->conf_thermal_solver && this->power_density_file_avail;
+		if (thermal_solver) {
+
+			this->thermalSolver.performSteadyStateAnalysis(thermal_solver_result, this->conf_layers, this->getOutline(), this->blocks,
+					this->thermalAnalyzer, this->conf_power_blurring_parameters, IO::mode == IO::Mode::THERMAL_ANALYSIS,
+					this->thread_pool.get(), this->logMed());
+		}
+
 		// logging results; consider non-normalized, actual values
 		if (this->logMin()) {
 
@@ -521,6 +2370,25 @@ void FloorPlanner::finalize(CorblivarCore& corb, bool const& determ_overall_cost
 			cout << "Corblivar> Temp cost (estimated max temp for lowest layer [K]): " << cost.thermal_actual_value << endl;
 			this->results << "Temp cost (estimated max temp for lowest layer [K]): " << cost.thermal_actual_value << endl;
 
+			if (this->conf_power_blurring_single_precision && this->power_density_file_avail) {
+				cout << "Corblivar>  Single-precision power blurring; max temp deviation from double precision [K]: " << abs(cost.thermal_actual_value - temp_double_precision.max_temp) << endl;
+				cout << "Corblivar>  Single-precision power blurring; max deviation of thermal map from double precision [K]: " << max_deviation_double_precision << endl;
+				this->results << " Single-precision power blurring; max temp deviation from double precision [K]: " << abs(cost.thermal_actual_value - temp_double_precision.max_temp) << endl;
+				this->results << " Single-precision power blurring; max deviation of thermal map from double precision [K]: " << max_deviation_double_precision << endl;
+			}
+
+			if (thermal_solver) {
+				cout << "Corblivar> Max temp for lowest layer, grid-based thermal analysis [K]: " << thermal_solver_result.max_temp << endl;
+				this->results << "Max temp for lowest layer, grid-based thermal analysis [K]: " << thermal_solver_result.max_temp << endl;
+			}
+
+			if (this->SA_early_termination_step != Point::UNDEF) {
+				cout << "Corblivar> SA early termination (converged) in step: " << this->SA_early_termination_step << "/" << this->conf_SA_loopLimit << endl;
+				cout << "Corblivar>  Saved steps: " << this->conf_SA_loopLimit - this->SA_early_termination_step << endl;
+				this->results << "SA early termination (converged) in step: " << this->SA_early_termination_step << "/" << this->conf_SA_loopLimit << endl;
+				this->results << " Saved steps: " << this->conf_SA_loopLimit - this->SA_early_termination_step << endl;
+			}
+
 			cout << endl;
 		}
 	}
@@ -537,12 +2405,26 @@ void FloorPlanner::finalize(CorblivarCore& corb, bool const& determ_overall_cost
 		this->solution_out.close();
 	}
 
+	// generate solution files and summary for Pareto archive
+	if (handle_corblivar && !this->Pareto_archive.empty()) {
+		IO::writeParetoArchive(*this);
+	}
+
+	// generate solution files and summary for multi-weight chains
+	if (handle_corblivar && !this->SA_chains.empty()) {
+		IO::writeSAChains(*this);
+	}
+
 	// thermal-analysis files
 	if ((!handle_corblivar || valid_solution) && this->power_density_file_avail) {
 		// generate power, thermal and TSV-density maps
 		IO::writePowerThermalTSVMaps(*this);
 		// generate HotSpot files
 		IO::writeHotSpotFiles(*this);
+		// generate files for results of grid-based thermal analysis
+		if (this->conf_thermal_solver) {
+			IO::writeThermalSolverMaps(*this);
+		}
 	}
 
 	// determine overall runtime
@@ -579,6 +2461,7 @@ bool FloorPlanner::generateLayout(CorblivarCore& corb, bool const& perform_align
 	// perform packing if desired; perform on each die for each
 	// dimension separately and subsequently; multiple iterations may
 	// provide denser packing configurations
+	this->dies_outline.resize(this->conf_layers);
 	for (int d = 0; d < this->conf_layers; d++) {
 
 		CorblivarDie& die = corb.editDie(d);
@@ -592,6 +2475,10 @@ bool FloorPlanner::generateLayout(CorblivarCore& corb, bool const& perform_align
 			}
 		}
 
+		// memorize die's outline, maintained during layout generation and
+		// packing
+		this->dies_outline[d] = die.getOutline();
+
 		// dbg: sanity check for valid layout
 		if (CorblivarCore::DBG_VALID_LAYOUT) {
 
@@ -605,10 +2492,24 @@ bool FloorPlanner::generateLayout(CorblivarCore& corb, bool const& perform_align
 	return ret;
 }
 
+void FloorPlanner::determDiesOutline() {
+	int i;
+
+	this->dies_outline.resize(this->conf_layers);
+	for (i = 0; i < this->conf_layers; i++) {
+		this->dies_outline[i].x = this->dies_outline[i].y = 0.0;
+	}
+
+	for (Block const& block : this->blocks) {
+		this->dies_outline[block.layer].x = max(this->dies_outline[block.layer].x, block.bb.ur.x);
+		this->dies_outline[block.layer].y = max(this->dies_outline[block.layer].y, block.bb.ur.y);
+	}
+}
+
 bool FloorPlanner::performRandomLayoutOp(CorblivarCore& corb, bool const& SA_phase_two, bool const& revertLastOp) {
 	int op;
 	int die1, die2, tuple1, tuple2, juncts;
-	bool ret, swapping_failed_blocks;
+	bool ret, swapping_failed_blocks, targeted_op;
 
 	if (FloorPlanner::DBG_CALLS_SA) {
 		cout << "-> FloorPlanner::performRandomLayoutOp(" << &corb << ", " << SA_phase_two << ", " << revertLastOp << ")" << endl;
@@ -634,9 +2535,30 @@ bool FloorPlanner::performRandomLayoutOp(CorblivarCore& corb, bool const& SA_pha
 			this->last_op = op = FloorPlanner::OP_SWAP_BLOCKS;
 		}
 
-		// for other regular cases or in case swapping failed blocks was not successful, we proceed with a random
-		// operation
-		if (!swapping_failed_blocks) {
+		// to speed up the interconnects optimization during phase II, we
+		// perform a share of targeted moves/swaps, i.e., blocks of nets w/
+		// high interconnects cost are moved towards their connected blocks
+		targeted_op = false;
+		if (!swapping_failed_blocks && SA_phase_two && this->conf_SA_opt_interconnects
+				&& Math::randF(0.0, 1.0) < this->conf_SA_targeted_ops_ratio) {
+
+			// reset layout operation variables
+			die1 = die2 = tuple1 = tuple2 = juncts = -1;
+
+			// try to setup targeted op; randomly decide for moving or
+			// swapping the block
+			targeted_op = this->prepareTargetedBlockOp(corb, die1, tuple1, die2, tuple2);
+			if (Math::randB()) {
+				this->last_op = op = FloorPlanner::OP_SWAP_BLOCKS;
+			}
+			else {
+				this->last_op = op = FloorPlanner::OP_MOVE_TUPLE;
+			}
+		}
+
+		// for other regular cases or in case swapping failed blocks or the
+		// targeted op was not successful, we proceed with a random operation
+		if (!swapping_failed_blocks && !targeted_op) {
 
 			// reset layout operation variables
 			die1 = die2 = tuple1 = tuple2 = juncts = -1;
@@ -681,6 +2603,20 @@ bool FloorPlanner::performRandomLayoutOp(CorblivarCore& corb, bool const& SA_pha
 			break;
 	}
 
+	// maintain shapes' hash for layout cache; the delta of the shaping op is
+	// memorized for reverting
+	if (ret && op == FloorPlanner::OP_ROTATE_BLOCK__SHAPE_BLOCK && !this->layout_cache.entries.empty()) {
+
+		if (!revertLastOp) {
+			Block const* shape_block = corb.getDie(die1).getBlock(tuple1);
+
+			this->layout_cache.shapes_hash_last_op =
+				this->blockShapeHash(shape_block, shape_block->bb_backup) ^ this->blockShapeHash(shape_block, shape_block->bb);
+		}
+
+		this->layout_cache.shapes_hash ^= this->layout_cache.shapes_hash_last_op;
+	}
+
 	// memorize elements of successful op
 	if (ret) {
 		this->last_op_die1 = die1;
@@ -858,6 +2794,19 @@ bool FloorPlanner::prepareBlockSwappingFailedAlignment(CorblivarCore const& corb
 			}
 		}
 
+		// for power-aware block handling, swapping is not allowed if blocks w/
+		// lower power density would end up in upper layers, see
+		// performOpMoveOrSwapBlocks; such a swap would be rejected repeatedly, thus
+		// ignore the neighbour in order to proceed w/ some random op
+		if (b1_neighbour != nullptr && this->conf_SA_layout_power_aware_block_handling) {
+			if (
+				(die1 < die2 && b1->power_density < b1_neighbour->power_density) ||
+				(die2 < die1 && b1_neighbour->power_density < b1->power_density)
+			   ) {
+				b1_neighbour = nullptr;
+			}
+		}
+
 		// determine related tuple of neigbhour block; == -1 in case the tuple
 		// cannot be find; sanity check for undefined neighbour
 		if (b1_neighbour != nullptr) {
@@ -883,6 +2832,165 @@ bool FloorPlanner::prepareBlockSwappingFailedAlignment(CorblivarCore const& corb
 	}
 }
 
+// targeted layout operation; a block of a net w/ high interconnects cost is moved or
+// swapped towards the centroid of its connected blocks, onto the die w/ most of these
+// blocks
+bool FloorPlanner::prepareTargetedBlockOp(CorblivarCore const& corb, int& die1, int& tuple1, int& die2, int& tuple2) const {
+	Net const* net = nullptr;
+	Block const* b1 = nullptr;
+	vector<int> layers_blocks;
+	double x, y, x_min, x_max, y_min, y_max;
+	double centroid_x, centroid_y;
+	double score, max_score, dist, opt_dist;
+	int layer_bottom, layer_top;
+	int count, t;
+
+	// sanity check for nets
+	if (this->nets.empty()) {
+		return false;
+	}
+
+	// select the net w/ the highest interconnects cost among some randomly sampled
+	// nets; the cost is estimated by the HPWL of the blocks' center points and by
+	// the layers spanned by the blocks, normalized as the related cost terms
+	max_score = -1.0;
+	for (int s = 0; s < FloorPlanner::SA_TARGETED_OPS_NET_SAMPLES; s++) {
+
+		Net const& cur_net = this->nets[Math::randI(0, this->nets.size())];
+
+		// nets w/ only one block provide no connected blocks to move towards
+		if (cur_net.blocks.size() < 2) {
+			continue;
+		}
+
+		x_min = y_min = numeric_limits<double>::max();
+		x_max = y_max = -numeric_limits<double>::max();
+		layer_bottom = layer_top = cur_net.blocks[0]->layer;
+
+		for (Block const* b : cur_net.blocks) {
+
+			x = (b->bb.ll.x + b->bb.ur.x) / 2.0;
+			y = (b->bb.ll.y + b->bb.ur.y) / 2.0;
+
+			x_min = min(x_min, x);
+			x_max = max(x_max, x);
+			y_min = min(y_min, y);
+			y_max = max(y_max, y);
+			layer_bottom = min(layer_bottom, b->layer);
+			layer_top = max(layer_top, b->layer);
+		}
+
+		score = 0.0;
+		if (this->max_cost_WL > 0.0) {
+			score += this->conf_SA_cost_WL * ((x_max - x_min) + (y_max - y_min)) / this->max_cost_WL;
+		}
+		if (this->max_cost_TSVs > 0) {
+			score += this->conf_SA_cost_TSVs * (layer_top - layer_bottom) / this->max_cost_TSVs;
+		}
+
+		if (score > max_score) {
+			max_score = score;
+			net = &cur_net;
+		}
+	}
+
+	// sanity check for selected net
+	if (net == nullptr) {
+		return false;
+	}
+
+	// select the net's block farthest from the net's centroid, i.e., the block
+	// most likely defining the net's bounding box
+	centroid_x = centroid_y = 0.0;
+	for (Block const* b : net->blocks) {
+		centroid_x += (b->bb.ll.x + b->bb.ur.x) / 2.0;
+		centroid_y += (b->bb.ll.y + b->bb.ur.y) / 2.0;
+	}
+	centroid_x /= net->blocks.size();
+	centroid_y /= net->blocks.size();
+
+	opt_dist = -1.0;
+	for (Block const* b : net->blocks) {
+
+		dist = abs((b->bb.ll.x + b->bb.ur.x) / 2.0 - centroid_x) + abs((b->bb.ll.y + b->bb.ur.y) / 2.0 - centroid_y);
+
+		if (dist > opt_dist) {
+			opt_dist = dist;
+			b1 = b;
+		}
+	}
+
+	// determine the centroid of all blocks connected to the selected block, along
+	// w/ the blocks count on each die
+	layers_blocks.assign(this->conf_layers, 0);
+	centroid_x = centroid_y = 0.0;
+	count = 0;
+	for (unsigned const& n : this->blocks_nets[b1->numerical_id]) {
+		for (Block const* b : this->nets[n].blocks) {
+
+			if (b->numerical_id == b1->numerical_id) {
+				continue;
+			}
+
+			centroid_x += (b->bb.ll.x + b->bb.ur.x) / 2.0;
+			centroid_y += (b->bb.ll.y + b->bb.ur.y) / 2.0;
+			layers_blocks[b->layer]++;
+			count++;
+		}
+	}
+
+	// sanity check for connected blocks
+	if (count == 0) {
+		return false;
+	}
+
+	centroid_x /= count;
+	centroid_y /= count;
+
+	// the block is to be placed onto the die w/ most connected blocks; for equal
+	// counts, the block remains on its die
+	die1 = die2 = b1->layer;
+	for (int i = 0; i < this->conf_layers; i++) {
+		if (layers_blocks[i] > layers_blocks[die2]) {
+			die2 = i;
+		}
+	}
+
+	// the block is to be moved/swapped to the position of the block nearest to
+	// the centroid
+	tuple2 = -1;
+	opt_dist = numeric_limits<double>::max();
+	for (t = 0; t < static_cast<int>(corb.getDie(die2).getCBL().size()); t++) {
+
+		Block const* b2 = corb.getDie(die2).getBlock(t);
+
+		if (b2->numerical_id == b1->numerical_id) {
+			continue;
+		}
+
+		dist = abs((b2->bb.ll.x + b2->bb.ur.x) / 2.0 - centroid_x) + abs((b2->bb.ll.y + b2->bb.ur.y) / 2.0 - centroid_y);
+
+		if (dist < opt_dist) {
+			opt_dist = dist;
+			tuple2 = t;
+		}
+	}
+
+	tuple1 = corb.getDie(die1).getTuple(b1);
+
+	// sanity check for found tuples
+	if (tuple1 == -1 || tuple2 == -1) {
+		return false;
+	}
+
+	if (FloorPlanner::DBG_SA) {
+		cout << "DBG_SA> targeted op; net " << net->id << ", block " << b1->id << " on layer " << die1;
+		cout << " towards block " << corb.getDie(die2).getBlock(tuple2)->id << " on layer " << die2 << endl;
+	}
+
+	return true;
+}
+
 bool FloorPlanner::performOpShapeBlock(bool const& revert, CorblivarCore& corb, int& die1, int& tuple1) const {
 	Block const* shape_block;
 
@@ -1279,8 +3387,65 @@ FloorPlanner::Cost FloorPlanner::evaluateLayout(vector<CorblivarAlignmentReq> co
 		cout << "-> FloorPlanner::evaluateLayout(" << &alignments << ", " << fitting_layouts_ratio << ", " << SA_phase_two << ", " << set_max_cost << ", " << finalize << ")" << endl;
 	}
 
+	cost = (this->*this->specializedLayoutEvaluation(SA_phase_two, finalize))(alignments, fitting_layouts_ratio, set_max_cost);
+
+	if (FloorPlanner::DBG_CALLS_SA) {
+		cout << "<- FloorPlanner::evaluateLayout : " << cost << endl;
+	}
+
+	return cost;
+}
+
+// select the layout evaluation specialized for the SA phase and the cost terms to
+// consider; for finalize calls, all cost terms are considered
+FloorPlanner::LayoutEvaluation FloorPlanner::specializedLayoutEvaluation(bool const& SA_phase_two, bool const& finalize) const {
+	bool interconnects, alignment, thermal;
+
 	// phase one: consider only cost for packing into outline
 	if (!SA_phase_two) {
+		return &FloorPlanner::evaluateLayoutSpecialized<false, false, false, false>;
+	}
+
+	interconnects = this->conf_SA_opt_interconnects || finalize;
+	alignment = this->conf_SA_opt_alignment || finalize;
+	thermal = this->conf_SA_opt_thermal || finalize;
+
+	if (interconnects && alignment && thermal) {
+		return &FloorPlanner::evaluateLayoutSpecialized<true, true, true, true>;
+	}
+	else if (interconnects && alignment) {
+		return &FloorPlanner::evaluateLayoutSpecialized<true, true, true, false>;
+	}
+	else if (interconnects && thermal) {
+		return &FloorPlanner::evaluateLayoutSpecialized<true, true, false, true>;
+	}
+	else if (alignment && thermal) {
+		return &FloorPlanner::evaluateLayoutSpecialized<true, false, true, true>;
+	}
+	else if (interconnects) {
+		return &FloorPlanner::evaluateLayoutSpecialized<true, true, false, false>;
+	}
+	else if (alignment) {
+		return &FloorPlanner::evaluateLayoutSpecialized<true, false, true, false>;
+	}
+	else if (thermal) {
+		return &FloorPlanner::evaluateLayoutSpecialized<true, false, false, true>;
+	}
+	else {
+		return &FloorPlanner::evaluateLayoutSpecialized<true, false, false, false>;
+	}
+}
+
+// layout evaluation, specialized for the SA phase and the cost terms to consider; this
+// way, disabled cost terms are not even compiled in, and the enabled ones can be
+// inlined into one routine
+template<bool SA_PHASE_TWO, bool OPT_INTERCONNECTS, bool OPT_ALIGNMENT, bool OPT_THERMAL>
+FloorPlanner::Cost FloorPlanner::evaluateLayoutSpecialized(vector<CorblivarAlignmentReq> const& alignments, double const& fitting_layouts_ratio, bool const& set_max_cost) {
+	Cost cost;
+	double cost_others;
+
+	// phase one: consider only cost for packing into outline
+	if (!SA_PHASE_TWO) {
 
 		// area and outline cost, already weighted w/ global weight factor
 		this->evaluateAreaOutline(cost, fitting_layouts_ratio);
@@ -1297,58 +3462,65 @@ FloorPlanner::Cost FloorPlanner::evaluateLayout(vector<CorblivarAlignmentReq> co
 		// area and outline cost, already weighted w/ global weight factor
 		this->evaluateAreaOutline(cost, fitting_layouts_ratio);
 
-		// determine interconnects cost; if interconnect opt is on or for finalize
-		// calls
-		if (this->conf_SA_opt_interconnects || finalize) {
+		// determine interconnects cost; also determines the nets' layer
+		// boundaries and bounding boxes on the fly
+		if (OPT_INTERCONNECTS) {
 			this->evaluateInterconnects(cost, set_max_cost);
 		}
 		else {
 			cost.HPWL = cost.HPWL_actual_value = 0.0;
 			cost.TSVs = cost.TSVs_actual_value = 0;
 			cost.TSVs_area_deadspace_ratio = 0.0;
+
+			// nets' layer boundaries and bounding boxes are still required
+			// for the thermal analysis
+			if (OPT_THERMAL) {
+				for (Net const& cur_net : this->nets) {
+					cur_net.updateBoundingBoxes(this->conf_layers);
+				}
+			}
 		}
 
 		// cost for failed alignments, i.e., alignment mismatches; also annotates
 		// failed request, this provides feedback for further alignment
 		// optimization
-		if (this->conf_SA_opt_alignment || finalize) {
+		if (OPT_ALIGNMENT) {
 			this->evaluateAlignments(cost, alignments, true, set_max_cost);
 		}
 		else {
 			cost.alignments = cost.alignments_actual_value = 0.0;
 		}
 
-		// temperature-distribution cost; if thermal opt is on or for finalize
-		// run; note that vertical buses impact heat conduction via TSVs, thus the
-		// block alignment / bus planning is analysed before thermal distribution
-		if (this->conf_SA_opt_thermal || finalize) {
+		// temperature-distribution cost; note that vertical buses impact heat
+		// conduction via TSVs, thus the block alignment / bus planning is
+		// analysed before thermal distribution
+		if (OPT_THERMAL) {
 			this->evaluateThermalDistr(cost, set_max_cost);
 		}
 		else {
 			cost.thermal = cost.thermal_actual_value = 0.0;
 		}
 
-		// determine total cost; weight and sum up cost terms
-		cost.total_cost =
-			FloorPlanner::SA_COST_WEIGHT_OTHERS * (
-					this->conf_SA_cost_WL * cost.HPWL
-					+ this->conf_SA_cost_TSVs * cost.TSVs
-					+ this->conf_SA_cost_alignment * cost.alignments
-					+ this->conf_SA_cost_thermal * cost.thermal
-				)
-			// area, outline cost is already weighted
-			+ cost.area_outline;
-
-		// determine total cost assuming a fitting ratio of 1.0
-		cost.total_cost_fitting =
-			FloorPlanner::SA_COST_WEIGHT_OTHERS * (
-					this->conf_SA_cost_WL * cost.HPWL
-					+ this->conf_SA_cost_TSVs * cost.TSVs
-					+ this->conf_SA_cost_alignment * cost.alignments
-					+ this->conf_SA_cost_thermal * cost.thermal
-				)
-			// consider only area term for ratio 1.0, see evaluateAreaOutline
-			+ cost.area_actual_value * FloorPlanner::SA_COST_WEIGHT_AREA_OUTLINE;
+		// weight and sum up cost terms; only enabled terms are considered
+		cost_others = 0.0;
+		if (OPT_INTERCONNECTS) {
+			cost_others += this->conf_SA_cost_WL * cost.HPWL;
+			cost_others += this->conf_SA_cost_TSVs * cost.TSVs;
+		}
+		if (OPT_ALIGNMENT) {
+			cost_others += this->conf_SA_cost_alignment * cost.alignments;
+		}
+		if (OPT_THERMAL) {
+			cost_others += this->conf_SA_cost_thermal * cost.thermal;
+		}
+		cost_others *= FloorPlanner::SA_COST_WEIGHT_OTHERS;
+
+		// determine total cost; area, outline cost is already weighted
+		cost.total_cost = cost_others + cost.area_outline;
+
+		// determine total cost assuming a fitting ratio of 1.0; consider only
+		// area term for ratio 1.0, see evaluateAreaOutline
+		cost.total_cost_fitting = cost_others + cost.area_actual_value * FloorPlanner::SA_COST_WEIGHT_AREA_OUTLINE;
 	}
 
 	if (FloorPlanner::DBG_LAYOUT) {
@@ -1356,26 +3528,26 @@ FloorPlanner::Cost FloorPlanner::evaluateLayout(vector<CorblivarAlignmentReq> co
 		cout << "Layout cost: " << cost.total_cost << endl;
 	}
 
-	if (FloorPlanner::DBG_CALLS_SA) {
-		cout << "<- FloorPlanner::evaluateLayout : " << cost << endl;
-	}
-
 	return cost;
 }
 
 void FloorPlanner::evaluateThermalDistr(Cost& cost, bool const& set_max_cost) {
 	ThermalAnalyzer::Temp temp;
+	// thermal analyzer for currently applied resolution
+	ThermalAnalyzer& analyzer = this->curThermalAnalyzer();
 
-	// generate power maps based on layout and blocks' power densities
-	this->thermalAnalyzer.generatePowerMaps(this->conf_layers, this->blocks,
-			this->getOutline(), this->conf_power_blurring_parameters);
+	// generate power maps based on layout and blocks' power densities; note that
+	// the thread pool is only available for the main floorplanner, not for the
+	// copies used by SA workers, i.e., it's never used in a nested manner
+	analyzer.generatePowerMaps(this->conf_layers, this->blocks,
+			this->getOutline(), this->conf_power_blurring_parameters, true, this->thread_pool.get());
 
 	// adapt power maps to account for TSVs' impact
-	this->thermalAnalyzer.adaptPowerMaps(this->conf_layers, this->TSVs, this->nets, this->conf_power_blurring_parameters);
+	analyzer.adaptPowerMaps(this->conf_layers, this->TSVs, this->nets, this->conf_power_blurring_parameters, this->thread_pool.get());
 
 	// perform actual thermal analysis
-	this->thermalAnalyzer.performPowerBlurring(temp, this->conf_layers,
-			this->conf_power_blurring_parameters);
+	analyzer.performPowerBlurring(temp, this->conf_layers,
+			this->conf_power_blurring_parameters, this->thread_pool.get());
 
 	// memorize max cost; initial sampling
 	if (set_max_cost) {
@@ -1412,16 +3584,10 @@ void FloorPlanner::evaluateAreaOutline(FloorPlanner::Cost& cost, double const& f
 	// determine outline and area
 	for (i = 0; i < this->conf_layers; i++) {
 
-		// determine outline for blocks on all dies separately
-		max_outline_x = max_outline_y = 0.0;
-		for (Block const& block : this->blocks) {
-
-			if (block.layer == i) {
-				// update max outline coords
-				max_outline_x = max(max_outline_x, block.bb.ur.x);
-				max_outline_y = max(max_outline_y, block.bb.ur.y);
-			}
-		}
+		// outline for blocks on all dies separately; maintained during layout
+		// generation, see generateLayout
+		max_outline_x = this->dies_outline[i].x;
+		max_outline_y = this->dies_outline[i].y;
 
 		// area, represented by blocks' outline; normalized to die area
 		dies_area.push_back((max_outline_x * max_outline_y) / (this->die_area));
@@ -1491,9 +3657,9 @@ void FloorPlanner::evaluateInterconnects(FloorPlanner::Cost& cost, bool const& s
 	// determine HPWL and TSVs for each net
 	for (Net& cur_net : this->nets) {
 
-		// set layer boundaries, i.e., determine lowest and uppermost layer of
-		// net's blocks
-		cur_net.setLayerBoundaries();
+		// determine the net's layer boundaries and bounding boxes; they are
+		// also required for the thermal analysis, see evaluateThermalDistr
+		cur_net.updateBoundingBoxes(this->conf_layers);
 
 		if (Net::DBG) {
 			cout << "DBG_NET> Determine interconnects for net " << cur_net.id << endl;
@@ -1534,12 +3700,12 @@ void FloorPlanner::evaluateInterconnects(FloorPlanner::Cost& cost, bool const& s
 
 				// determine HPWL using the net's bounding box on the
 				// current layer
-				bb = cur_net.determBoundingBox(i);
+				bb = cur_net.boundingBox(i);
 				cost.HPWL += bb.w;
 				cost.HPWL += bb.h;
 
 				if (Net::DBG) {
-					cout << "DBG_NET> 		HPWL of bounding box of blocks (in current and possibly upper layers) to consider: " << (bb.w + bb. h) << endl;
+					cout << "DBG_NET> 		HPWL of bounding box of blocks (in current and possibly upper layers) to consider: " << (bb.w + bb.h) << endl;
 				}
 			}
 		}
@@ -27,8 +27,12 @@
 #include "Corblivar.incl.hpp"
 // Corblivar includes, if any
 #include "Block.hpp"
+#include "CornerBlockList.hpp"
+#include "Math.hpp"
 #include "Net.hpp"
 #include "ThermalAnalyzer.hpp"
+#include "ThermalSolver.hpp"
+#include "ThreadPool.hpp"
 // forward declarations, if any
 class CorblivarCore;
 class CorblivarAlignmentReq;
@@ -49,6 +53,10 @@ class FloorPlanner {
 		vector<Pin> terminals;
 		vector<Net> nets;
 
+		// block-to-net index, i.e., indices of the nets of each block; see
+		// initBlocksNets
+		vector< vector<unsigned> > blocks_nets;
+
 		// groups of TSVs, will be defined from nets and vertical buses
 		vector<TSV_Group> TSVs;
 
@@ -63,6 +71,9 @@ class FloorPlanner {
 
 		// 3D IC characteristica, resulting from config
 		double die_AR, die_area;
+		// outline of each die's current layout, i.e., max upper-right coordinates
+		// of the die's blocks; see generateLayout and determDiesOutline
+		vector<Point> dies_outline;
 		// these parameters cover all dies
 		double blocks_area;
 		double stack_area, stack_deadspace;
@@ -101,7 +112,7 @@ class FloorPlanner {
 		};
 
 		// IO
-		string benchmark, blocks_file, alignments_file, pins_file, power_density_file, nets_file;
+		string benchmark, config_file, blocks_file, alignments_file, pins_file, power_density_file, nets_file;
 		ofstream results, solution_out;
 		ifstream solution_in;
 		struct timeb start;
@@ -120,6 +131,151 @@ class FloorPlanner {
 		// SA parameters: loop control
 		double conf_SA_loopFactor, conf_SA_loopLimit;
 
+		// SA parameters: convergence-based early termination; the step where
+		// the SA run was terminated is memorized for reporting
+		int conf_SA_early_termination_steps;
+		double conf_SA_early_termination_std_dev;
+		int SA_early_termination_step;
+
+		// SA parameters: parallelization
+		int conf_SA_threads;
+		bool conf_SA_speculative_ops;
+
+		// SA: thread pool; persistent worker threads, initialized once after
+		// parsing the config
+		unique_ptr<ThreadPool> thread_pool;
+
+		// SA: workers for parallel evaluation of layout operations; each worker
+		// operates on its own copy of the chip data and the CBLs, and draws from
+		// its own random-number engine
+		vector< unique_ptr<FloorPlanner> > SA_workers_fp;
+		vector< unique_ptr<CorblivarCore> > SA_workers_corb;
+		vector<Cost> SA_workers_cost;
+
+		// random-number engine of this floorplanner; applied for tasks on worker
+		// threads, see Math::RandomEngineScope. Each copy is seeded separately
+		Math::RandomEngine random_engine;
+
+		// SA: layout journal, i.e., undo log for layout operations; memorizes the
+		// current (accepted) layout, such that the layout of a rejected operation
+		// can be reverted w/o regenerating and reevaluating the current layout
+		struct LayoutJournal {
+			// blocks' coordinates and alignment status, by numerical id
+			vector<Rect> bbs;
+			vector<Block::AlignmentStatus> alignments;
+			// alignment requests' status
+			vector<bool> alignments_fulfilled;
+			// dies' outline
+			vector<Point> dies_outline;
+			// ids of blocks changed by the last committed operation
+			vector<int> changed;
+		} layout_journal;
+
+		// SA parameters: layout cache, i.e., max entries; 0 disables the cache
+		int conf_SA_layout_cache_size;
+
+		// SA: layout cache, i.e., transposition table memorizing the cost of
+		// evaluated layouts; keyed by a hash of all dies' CBLs and all blocks'
+		// shapes. The table is direct-mapped, i.e., bounded, and entries are only
+		// valid within the temperature step they were stored in, since the cost
+		// function varies across steps
+		struct LayoutCache {
+			struct Entry {
+				unsigned long long hash;
+				// temperature step of entry; 0 for unused entries
+				int step = 0;
+				Cost cost;
+			};
+			vector<Entry> entries;
+			// hash of all blocks' shapes; maintained by layout operations,
+			// the delta of the last shaping operation is memorized for
+			// reverting
+			unsigned long long shapes_hash, shapes_hash_last_op;
+			// statistics, for current temperature step and overall
+			unsigned long lookups, hits;
+			unsigned long lookups_total, hits_total;
+		} layout_cache;
+
+		// SA parameters: Pareto archive, i.e., max solutions; 0 disables the
+		// archive
+		int conf_SA_Pareto_archive_size;
+
+		// SA: Pareto archive, i.e., fitting solutions which are non-dominated
+		// w.r.t. the actual values of HPWL, TSVs, temperature and alignment
+		// mismatches; the solutions are memorized as CBLs and blocks' bbs,
+		// along w/ the temperature step they were found in. For finalization,
+		// the solutions are reevaluated and also memorized in the format of
+		// solution files
+		struct ParetoSolution {
+			Cost cost;
+			vector<CornerBlockList> CBLs;
+			vector<Rect> bbs;
+			int step;
+			string solution;
+		};
+		vector<ParetoSolution> Pareto_archive;
+
+		// SA parameters: multi-weight chains, i.e., further vectors of cost
+		// factors (thermal, WL, TSVs, alignment); empty disables the chains
+		vector< array<double, 4> > conf_SA_chains_weights;
+
+		// SA: multi-weight chains; each chain optimizes its own copy of the layout
+		// w/ its own cost factors, in lockstep w/ the main SA loop, i.e., w/ the
+		// same temperature. The chains are
+		// forked from the main layout once SA phase two is reached, i.e., the
+		// weight-independent phase one is performed only once. The cost terms of
+		// evaluated layouts are shared via the layout cache, thus each layout is
+		// evaluated only once for all chains. The chains' best solutions are
+		// reevaluated and memorized in the format of solution files for
+		// finalization
+		struct SAChain {
+			unique_ptr<FloorPlanner> fp;
+			unique_ptr<CorblivarCore> corb;
+			double cur_cost, best_cost;
+			bool valid_layout_found;
+			// fitting ratio, as for the main SA loop, along w/ the related
+			// counters for the current temperature step
+			double fitting_layouts_ratio;
+			int accepted_ops, layout_fit_counter;
+			// state of current layout op
+			unsigned long long hash;
+			bool cached;
+			Cost cost;
+			// statistics: evaluated layouts and layouts shared from cache
+			unsigned long evaluations, shared;
+			// final solution
+			string solution;
+		};
+		vector<SAChain> SA_chains;
+
+		// SA parameters: targeted layout operations, i.e., ratio of block moves
+		// and swaps driven by the nets' interconnects, w.r.t. random operations;
+		// 0 disables targeted operations
+		double conf_SA_targeted_ops_ratio;
+		// SA parameters: targeted layout operations; nets randomly sampled for
+		// selecting the net w/ the highest interconnects cost
+		static constexpr int SA_TARGETED_OPS_NET_SAMPLES = 4;
+
+		// SA parameters: hierarchical floorplanning, i.e., max blocks per
+		// cluster; 0 disables hierarchical floorplanning
+		int conf_SA_hierarchical_cluster_size;
+
+		// SA parameters: hierarchical floorplanning; utilization of the dies by
+		// clusters, i.e., the remaining deadspace is reserved within the
+		// clusters. Some slack is left for packing the clusters into the dies;
+		// the clusters' layouts are scaled to span their die afterwards, i.e.,
+		// the slack is eventually also reserved within the clusters
+		static constexpr double SA_HIERARCHICAL_TOP_UTILIZATION = 0.9;
+		// SA parameters: hierarchical floorplanning; min operation-factor and
+		// restarts of SA for regions, i.e., dies and clusters; min operations
+		// per temperature step for regions w/ few blocks
+		static constexpr double SA_HIERARCHICAL_LOOP_FACTOR = 1.5;
+		static constexpr double SA_HIERARCHICAL_MIN_OPS = 100.0;
+		static constexpr int SA_HIERARCHICAL_TRIALS = 3;
+		// SA parameters: hierarchical floorplanning; AR range for clusters
+		static constexpr double SA_HIERARCHICAL_CLUSTER_AR_MIN = 0.5;
+		static constexpr double SA_HIERARCHICAL_CLUSTER_AR_MAX = 2.0;
+
 		// SA parameters: optimization flags
 		bool conf_SA_opt_thermal, conf_SA_opt_interconnects, conf_SA_opt_alignment;
 
@@ -130,6 +286,18 @@ class FloorPlanner {
 		double max_cost_thermal, max_cost_WL, max_cost_alignments;
 		int max_cost_TSVs;
 
+		// SA parameters: multi-resolution thermal analysis; the thermal cost is
+		// determined w/ coarse resolutions for high temperatures and w/ finer
+		// resolutions as the temperature drops
+		bool conf_SA_thermal_multi_resolution;
+		// SA parameters: multi-resolution thermal analysis; factors for coarse
+		// resolutions, i.e., reduction of thermal-map dimension, and the
+		// related temperature limits, relative to the temperature at start of
+		// phase two, below which the next finer resolution is applied
+		static constexpr int SA_THERMAL_LEVELS = 2;
+		static constexpr int SA_THERMAL_LEVELS_FACTOR[SA_THERMAL_LEVELS] = {4, 2};
+		static constexpr double SA_THERMAL_LEVELS_TEMP[SA_THERMAL_LEVELS] = {0.1, 0.01};
+
 		// SA cost paramters: global weights, enforce that area and outline
 		// violation is constantly considered; related weight should be >= 0.5 in
 		// order to enforce guiding into outline during whole optimization run
@@ -142,6 +310,13 @@ class FloorPlanner {
 				bool const& SA_phase_two = false,
 				bool const& set_max_cost = false,
 				bool const& finalize = false);
+		// SA: cost functions, specialized for the SA phase and the cost terms to
+		// consider; selected once per SA phase, the generic evaluateLayout
+		// dispatches to them as well
+		typedef Cost (FloorPlanner::*LayoutEvaluation)(vector<CorblivarAlignmentReq> const& alignments, double const& fitting_layouts_ratio, bool const& set_max_cost);
+		LayoutEvaluation specializedLayoutEvaluation(bool const& SA_phase_two, bool const& finalize = false) const;
+		template<bool SA_PHASE_TWO, bool OPT_INTERCONNECTS, bool OPT_ALIGNMENT, bool OPT_THERMAL>
+		Cost evaluateLayoutSpecialized(vector<CorblivarAlignmentReq> const& alignments, double const& fitting_layouts_ratio, bool const& set_max_cost);
 		void evaluateThermalDistr(Cost& cost,
 				bool const& set_max_cost = false);
 		void evaluateAlignments(Cost& cost,
@@ -178,10 +353,15 @@ class FloorPlanner {
 		// SA parameters: layout generation options
 		bool conf_SA_layout_enhanced_hard_block_rotation, conf_SA_layout_enhanced_soft_block_shaping;
 		bool conf_SA_layout_power_aware_block_handling, conf_SA_layout_floorplacement;
+		bool conf_SA_layout_constructive_init;
+		bool conf_SA_layout_mincut_die_assignment;
 		int conf_SA_layout_packing_iterations;
 
 		// SA: layout-generation handler
 		bool generateLayout(CorblivarCore& corb, bool const& perform_alignment);
+		// layout helper: determine dies' outline for layouts not generated from
+		// CBLs, e.g., for hierarchical floorplanning
+		void determDiesOutline();
 
 		// SA: layout operations op-codes
 		static constexpr int OP_SWAP_BLOCKS = 1;
@@ -204,6 +384,7 @@ class FloorPlanner {
 		// note that die and tuple parameters are return-by-reference; non-const
 		// reference for CorblivarCore in order to enable operations on CBL-encode data
 		inline bool prepareBlockSwappingFailedAlignment(CorblivarCore const& corb, int& die1, int& tuple1, int& die2, int& tuple2);
+		inline bool prepareTargetedBlockOp(CorblivarCore const& corb, int& die1, int& tuple1, int& die2, int& tuple2) const;
 		inline bool performOpMoveOrSwapBlocks(int const& mode, bool const& revert, bool const& SA_phase_one, CorblivarCore& corb,
 				int& die1, int& die2, int& tuple1, int& tuple2) const;
 		inline bool performOpSwitchInsertionDirection(bool const& revert, CorblivarCore& corb, int& die1, int& tuple1) const;
@@ -232,13 +413,206 @@ class FloorPlanner {
 		// SA: helper for main handler
 		// note that various parameters are return-by-reference
 		void initSA(CorblivarCore& corb, vector<double>& cost_samples, int& innerLoopMax, double& init_temp);
+		void performSampling(CorblivarCore& corb, int const& ops, vector<double>& cost_samples);
 		inline void updateTemp(double& cur_temp, int const& iteration, int const& iteration_first_valid_layout) const;
 
+		// SA: helper for parallel evaluation of layout operations
+		void initSAWorkers(CorblivarCore const& corb);
+		void initLayoutCopy(CorblivarCore const& corb, FloorPlanner& fp, CorblivarCore& copy_corb) const;
+		void copyLayoutState(FloorPlanner const& fp, CorblivarCore const& corb_source, CorblivarCore& corb);
+		void copyLayoutState(FloorPlanner const& fp, CorblivarCore const& corb_source, CorblivarCore& corb, int const& die1, int const& die2);
+
+		// SA: helper for layout journal; initialization memorizes the current
+		// layout, committing memorizes the layout of an accepted operation, and
+		// reverting restores the current layout after a rejected (and already
+		// reverted) operation; the latter two consider only changed blocks
+		void initLayoutJournal(CorblivarCore const& corb);
+		void commitLayoutJournal(CorblivarCore const& corb);
+		void revertLayoutJournal(CorblivarCore const& corb);
+
+		// SA: helper for layout cache; the hash considers the CBLs and the blocks'
+		// shapes, which define the resulting layout
+		void initLayoutCache(int const& step);
+		unsigned long long layoutHash(CorblivarCore const& corb) const;
+		inline unsigned long long blockShapeHash(Block const* block, Rect const& bb) const {
+			return Math::hash(Math::hash(Math::hash(block->numerical_id) ^ hash<double>()(bb.w)) ^ hash<double>()(bb.h));
+		};
+		bool lookupLayoutCache(unsigned long long const& hash, int const& step, Cost& cost);
+		void storeLayoutCache(unsigned long long const& hash, int const& step, Cost const& cost);
+
+		// SA: helper for Pareto archive; the archive is bounded, i.e., in case it's
+		// full, the solution w/ the nearest neighbor in the (normalized) objective
+		// space is dropped
+		void updateParetoArchive(CorblivarCore const& corb, Cost const& cost, int const& step);
+		void finalizeParetoArchive(CorblivarCore& corb);
+		inline static bool dominates(Cost const& c1, Cost const& c2) {
+			return (c1.HPWL_actual_value <= c2.HPWL_actual_value
+					&& c1.TSVs_actual_value <= c2.TSVs_actual_value
+					&& c1.thermal_actual_value <= c2.thermal_actual_value
+					&& c1.alignments_actual_value <= c2.alignments_actual_value)
+				&& (c1.HPWL_actual_value < c2.HPWL_actual_value
+					|| c1.TSVs_actual_value < c2.TSVs_actual_value
+					|| c1.thermal_actual_value < c2.thermal_actual_value
+					|| c1.alignments_actual_value < c2.alignments_actual_value);
+		};
+
+		// SA: helper for multi-weight chains; the random layout ops of all chains
+		// are performed sequentially, the evaluation of layouts not shared via
+		// the layout cache is performed in parallel, if possible
+		void initSAChains(CorblivarCore const& corb);
+		void initSAChainsStep(int const& step);
+		void performSAChainsLayoutOps(int const& step, double const& cur_temp);
+		void finalizeSAChains();
+		// weight and sum up the phase-two cost terms w/ the cost factors of this
+		// floorplanner; required for shared costs evaluated by other chains. The
+		// area and outline cost is redetermined from the actual values for the
+		// given fitting ratio, see evaluateAreaOutline
+		inline void weightCost(Cost& cost, double const& fitting_layouts_ratio) const {
+			double cost_others;
+
+			cost.area_outline = 0.5 * FloorPlanner::SA_COST_WEIGHT_AREA_OUTLINE * (1.0 - fitting_layouts_ratio) * cost.outline_actual_value;
+			cost.area_outline += 0.5 * FloorPlanner::SA_COST_WEIGHT_AREA_OUTLINE * (1.0 + fitting_layouts_ratio) * cost.area_actual_value;
+
+			cost_others = this->conf_SA_cost_WL * cost.HPWL;
+			cost_others += this->conf_SA_cost_TSVs * cost.TSVs;
+			cost_others += this->conf_SA_cost_alignment * cost.alignments;
+			cost_others += this->conf_SA_cost_thermal * cost.thermal;
+			cost_others *= FloorPlanner::SA_COST_WEIGHT_OTHERS;
+
+			cost.total_cost = cost_others + cost.area_outline;
+			cost.total_cost_fitting = cost_others + cost.area_actual_value * FloorPlanner::SA_COST_WEIGHT_AREA_OUTLINE;
+		};
+
+		// note that ii, i.e., the inner-loop counter, and the cost of the
+		// accepted layout operation are return-by-reference
+		bool performSpeculativeLayoutOps(CorblivarCore& corb, bool const& SA_phase_two, double const& fitting_layouts_ratio,
+				double const& cur_temp, double const& cur_cost, int& ii, int const& innerLoopMax, Cost& cost);
+
+		// SA: helper for hierarchical floorplanning; the top-level floorplanner
+		// handles clusters as soft blocks. Regions, i.e., dies for clusters and
+		// clusters for blocks, are floorplanned separately
+		void initClustersFloorPlanner(FloorPlanner& top, vector< vector<int> > const& clusters_blocks) const;
+		bool performRegionsSA(FloorPlanner const& fp, vector< vector<int> > const& regions_blocks, vector<int> const& blocks_region,
+				vector<Rect> const& regions, vector<int> const& regions_layer, string const& regions_name) const;
+		bool performRegionSA(vector<int> const& region_blocks, vector<int> const& blocks_region, vector<Rect> const& regions, int const& region,
+				vector<Rect>& region_bbs) const;
+
 		// thermal analyzer
 		ThermalAnalyzer thermalAnalyzer;
+		// thermal analyzers for coarse resolutions, ordered from coarsest to
+		// finest, and the currently applied resolution level; the level equal
+		// to the number of coarse analyzers refers to the regular thermal
+		// analyzer, i.e., to the full resolution
+		vector<ThermalAnalyzer> thermalAnalyzer_levels;
+		unsigned thermal_level;
+
+		// thermal analyzer for currently applied resolution
+		inline ThermalAnalyzer& curThermalAnalyzer() {
+			if (this->thermal_level < this->thermalAnalyzer_levels.size()) {
+				return this->thermalAnalyzer_levels[this->thermal_level];
+			}
+			else {
+				return this->thermalAnalyzer;
+			}
+		};
+		// apply resolution level for thermal analysis; the max thermal cost
+		// is renormalized such that costs remain comparable
+		void updateThermalLevel(unsigned const& level, vector<CorblivarAlignmentReq> const& alignments, double const& fitting_layouts_ratio);
 
-		// thermal analyzer parameters; thermal mask parameters
+		// thermal analyzer parameters; thermal mask parameters, resolution,
+		// precision of convolution, and TSV-density-aware masks
 		ThermalAnalyzer::MaskParameters conf_power_blurring_parameters;
+		int conf_power_blurring_thermal_map_dim, conf_power_blurring_thermal_mask_dim;
+		bool conf_power_blurring_single_precision;
+		bool conf_power_blurring_TSV_density_masks;
+
+		// grid-based thermal solver; steady-state thermal analysis of final
+		// layouts
+		ThermalSolver thermalSolver;
+		bool conf_thermal_solver;
+
+		// thermal-analysis fitting: in-process fitting of the power-blurring
+		// parameters against the grid-based thermal analysis; Nelder-Mead
+		// searches are started from multiple points, processed in parallel.
+		// The parameters are fitted in the order impulse factor, impulse-scaling
+		// factor, mask boundary value, power-density scaling in padding zone and
+		// in TSV regions; the temperature offset is determined directly for each
+		// set of parameters. Implemented along w/ the ThermalAnalyzerFitting
+		// tool, i.e., in src_aux/ThermalAnalyzerFitting.cpp
+		static constexpr int FITTING_PARAMETERS = 5;
+		typedef array<double, FITTING_PARAMETERS> FittingPoint;
+		// starting points, i.e., parallel Nelder-Mead searches; the first
+		// starting point refers to the configured parameters
+		static constexpr unsigned FITTING_STARTS = 8;
+		// upper limit for power-density scaling in padding zone
+		static constexpr double FITTING_PDPZ_MAX = 2.0;
+		// searches are stopped once the error is not further reduced within
+		// the simplex by this relative amount
+		static constexpr double FITTING_TOLERANCE = 1.0e-06;
+		// upper limit for iterations of each search; no fitting is performed
+		// for zero
+		int fitting_iterations;
+
+		void fittingNelderMead(FittingPoint& point, double& error, ThermalAnalyzer& analyzer, vector<TSV_Group>& TSVs, vector<Net>& nets,
+				vector< vector<double> > const& reference) const;
+		// mean squared error between thermal maps of power blurring and
+		// grid-based thermal analysis, for the best-fitting temperature
+		// offset; returns max double for infeasible parameters
+		double evaluateFitting(FittingPoint const& point, ThermalAnalyzer& analyzer, vector<TSV_Group>& TSVs, vector<Net>& nets,
+				vector< vector<double> > const& reference, double* temp_offset = nullptr, double* mean_abs_error = nullptr) const;
+		ThermalAnalyzer::MaskParameters fittingParameters(FittingPoint const& point) const;
+
+		// SA-parameter tuning: racing of SA-parameter configurations across a
+		// set of benchmarks, i.e., successive halving: in each round, all
+		// remaining configurations are run once more for each benchmark and the
+		// worse half is dropped. The parameters are tuned in the order
+		// inner-loop operation factor, start temperature-scaling factor, and
+		// temperature-scaling factors for phase 1 (initial, final), phase 2
+		// and phase 3. Implemented along w/ the SAParameterTuning tool, i.e., in
+		// src_aux/SAParameterTuning.cpp
+		static constexpr int TUNING_PARAMETERS = 6;
+		typedef array<double, TUNING_PARAMETERS> TuningPoint;
+		// range for inner-loop operation factor, additive to configured factor
+		static constexpr double TUNING_LOOP_FACTOR_RANGE = 0.2;
+		// range for start temperature-scaling factor, as orders of magnitude
+		// w.r.t. configured factor
+		static constexpr double TUNING_TEMP_INIT_FACTOR_RANGE = 1.0;
+		// objective of runs not finding any fitting solution; the objective of
+		// an average run is approx. 1.0 plus the weighted runtime term
+		static constexpr double TUNING_PENALTY_NON_FITTING = 2.0;
+		// configurations; the first configuration refers to the configured
+		// parameters, the others are randomly drawn around them
+		int tuning_configurations;
+		// weight of the runtime term in the objective, relative to the cost term
+		double tuning_runtime_weight;
+
+		struct TuningConfiguration {
+			TuningPoint point;
+			// objectives of all runs for all benchmarks
+			vector<double> objectives;
+			double avg_objective;
+			// round in which configuration was dropped; 0 for the remaining one
+			int dropped;
+		};
+		vector<TuningConfiguration> tuning_configs;
+		// tuned configuration, i.e., the one remaining
+		unsigned tuning_best;
+
+		struct TuningRun {
+			unsigned config;
+			unsigned benchmark;
+			// seed of the run's random-number engine; each run draws from
+			// its own engine, independent of the thread processing it
+			unsigned seed;
+			bool valid;
+			Cost cost;
+			double runtime;
+		};
+		void performTuningRun(TuningRun& run, FloorPlanner const& benchmark) const;
+		// objective, i.e., cost terms (as weighted by the configured cost factors)
+		// and runtime, both normalized w/ the reference values, i.e., the avg
+		// values of all configurations' first runs for the run's benchmark
+		double evaluateTuningRun(TuningRun const& run, FloorPlanner const& benchmark, array<double, 5> const& reference) const;
 
 	// constructors, destructors, if any non-implicit
 	public:
@@ -246,9 +620,26 @@ class FloorPlanner {
 			// memorize start time
 			ftime(&(this->start));
 
-			// init random number generator
-			srand(time(0));
+			// init random-number engine; seeded from the calling thread's
+			// engine
+			this->random_engine.seed(Math::randSeed());
+
+			// init SA early-termination step, i.e., no early termination
+			// as default
+			this->SA_early_termination_step = Point::UNDEF;
+
+			// no SA-parameter tuning as default
+			this->tuning_configurations = 0;
+			this->tuning_runtime_weight = 0.0;
 		}
+		// copy constructor; required for workers of parallel SA evaluation. Note
+		// that IO streams, the thread pool, workers and chains are not copied;
+		// all other members are copied, i.e., further members have to be
+		// considered in the copy constructor as well
+		FloorPlanner(FloorPlanner const& fp);
+		// destructor; defined in implementation in order to handle the
+		// forward-declared class of workers' Corblivar cores
+		~FloorPlanner();
 
 	// public data, functions
 	public:
@@ -266,14 +657,7 @@ class FloorPlanner {
 		};
 
 		// ThermalAnalyzer: handler
-		inline void initThermalAnalyzer() {
-
-			// init sets of thermal masks
-			this->thermalAnalyzer.initThermalMasks(this->conf_layers, this->logMed(), this->conf_power_blurring_parameters);
-
-			// init power maps, i.e. predetermine maps parameters
-			this->thermalAnalyzer.initPowerMaps(this->conf_layers, this->getOutline());
-		};
+		void initThermalAnalyzer();
 
 		// getter / setter
 		inline int const& getLayers() const {
@@ -293,6 +677,19 @@ class FloorPlanner {
 			return this->conf_SA_layout_power_aware_block_handling;
 		};
 
+		inline bool const& constructiveInit() {
+			return this->conf_SA_layout_constructive_init;
+		};
+
+		inline bool const& minCutDieAssignment() {
+			return this->conf_SA_layout_mincut_die_assignment;
+		};
+
+		inline bool hierarchicalMode() const {
+			return (this->conf_SA_hierarchical_cluster_size > 0
+					&& this->blocks.size() > static_cast<unsigned>(this->conf_SA_hierarchical_cluster_size));
+		};
+
 		inline string const& getBenchmark() const {
 			return this->benchmark;
 		};
@@ -301,6 +698,10 @@ class FloorPlanner {
 			return this->blocks;
 		};
 
+		inline vector<Net> const& getNets() const {
+			return this->nets;
+		};
+
 		// additional helper
 		//
 		inline void resetDieProperties(double const& outline_x, double const& outline_y) {
@@ -311,6 +712,9 @@ class FloorPlanner {
 
 			// this also requires to reset the power maps setting
 			this->thermalAnalyzer.initPowerMaps(this->conf_layers, this->getOutline());
+			for (ThermalAnalyzer& analyzer : this->thermalAnalyzer_levels) {
+				analyzer.initPowerMaps(this->conf_layers, this->getOutline());
+			}
 
 			// reset related die properties
 			this->die_AR = this->conf_outline_x / this->conf_outline_y;
@@ -342,15 +746,46 @@ class FloorPlanner {
 				pin.bb.ur.x = pin.bb.ll.x;
 				pin.bb.ur.y = pin.bb.ll.y;
 			}
+			// also update nets' bounding boxes of terminal pins
+			for (Net& net : this->nets) {
+				net.initTerminalsBoundingBox();
+			}
 		}
 
 		inline bool inputSolutionFileOpen() const {
 			return this->solution_in.is_open();
 		};
 
+		// thread pool handler; only reasonable after parsing config file
+		void initThreadPool();
+
+		// SA: init Corblivar data, i.e., assignment of blocks to dies and
+		// generation of the initial CBLs
+		void initCorblivar(CorblivarCore& corb) const;
+		// SA: init block-to-net index, required for targeted layout operations
+		void initBlocksNets();
+
 		// SA: handler
 		bool performSA(CorblivarCore& corb);
+		// hierarchical floorplanning; the blocks' final layout is memorized in
+		// the blocks, the CBLs are not determined. If the hierarchical layout
+		// does not fit, flat floorplanning is performed on the given corb
+		bool performHierarchicalSA(CorblivarCore& corb);
 		void finalize(CorblivarCore& corb, bool const& determ_overall_cost = true, bool const& handle_corblivar = true);
+
+		// thermal-analysis fitting: handler; only reasonable after finalize,
+		// i.e., after the grid-based thermal analysis of the final layout; only
+		// available for the ThermalAnalyzerFitting tool
+		inline bool fittingRequested() const {
+			return (this->fitting_iterations > 0);
+		};
+		void fitPowerBlurringParameters();
+
+		// SA-parameter tuning: handler; the benchmarks are to be parsed and
+		// initialized beforehand. The tuned parameters are written as config
+		// file, along w/ a summary of all configurations; only available for the
+		// SAParameterTuning tool
+		void tuneSAParameters(vector< unique_ptr<FloorPlanner> > const& benchmarks);
 };
 
 #endif
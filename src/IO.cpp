@@ -27,6 +27,7 @@
 #include "FloorPlanner.hpp"
 #include "Chip.hpp"
 #include "ThermalAnalyzer.hpp"
+#include "ThermalSolver.hpp"
 #include "CornerBlockList.hpp"
 #include "CorblivarCore.hpp"
 #include "CorblivarAlignmentReq.hpp"
@@ -47,10 +48,11 @@ void IO::parseParametersFiles(FloorPlanner& fp, int const& argc, char** argv) {
 	stringstream power_density_file;
 	stringstream nets_file;
 	string tmpstr;
+	int chains, c;
 	ThermalAnalyzer::MaskParameters mask_parameters;
 
-	// program parameters; two modes, one for regular Corblivar runs, one for for
-	// thermal-analysis parameterization runs
+	// program parameters; three modes, one for regular Corblivar runs, one for for
+	// thermal-analysis parameterization runs, one for SA-parameter tuning runs
 	if (IO::mode == IO::Mode::REGULAR) {
 		if (argc < 4) {
 			cout << "IO> Usage: " << argv[0] << " benchmark_name config_file benchmarks_dir [solution_file]" << endl;
@@ -64,12 +66,27 @@ void IO::parseParametersFiles(FloorPlanner& fp, int const& argc, char** argv) {
 	}
 	else if (IO::mode == IO::Mode::THERMAL_ANALYSIS) {
 		if (argc < 6) {
-			cout << "IO> Usage: " << argv[0] << " benchmark_name config_file benchmarks_dir solution_file TSV_density" << endl;
+			cout << "IO> Usage: " << argv[0] << " benchmark_name config_file benchmarks_dir solution_file TSV_density [fitting_iterations]" << endl;
 			cout << "IO> " << endl;
 			cout << "IO> Expected config_file format: see provided Corblivar.conf" << endl;
 			cout << "IO> Expected benchmarks: any in GSRC Bookshelf format" << endl;
 			cout << "IO> Expected solution_file: any in Corblivar format" << endl;
 			cout << "IO> Expected TSV density: average TSV density for whole chip, to be given in \%" << endl;
+			cout << "IO> Note: fitting_iterations can be used to fit the power-blurring parameters in-process, against the grid-based thermal analysis;" << endl;
+			cout << "IO>  the value limits the iterations for each Nelder-Mead search" << endl;
+
+			exit(1);
+		}
+	}
+	else if (IO::mode == IO::Mode::SA_TUNING) {
+		if (argc < 4) {
+			cout << "IO> Usage: " << argv[0] << " benchmark_names config_file benchmarks_dir [configurations] [runtime_weight]" << endl;
+			cout << "IO> " << endl;
+			cout << "IO> Expected benchmark_names: comma-separated list, e.g., n100,n200,n300" << endl;
+			cout << "IO> Expected config_file format: see provided Corblivar.conf" << endl;
+			cout << "IO> Expected benchmarks: any in GSRC Bookshelf format" << endl;
+			cout << "IO> Note: configurations defines the SA-parameter configurations to be raced (default 16);" << endl;
+			cout << "IO>  runtime_weight defines the weight of the runtime in the objective, relative to the cost (default 0.2)" << endl;
 
 			exit(1);
 		}
@@ -77,6 +94,7 @@ void IO::parseParametersFiles(FloorPlanner& fp, int const& argc, char** argv) {
 
 	fp.benchmark = argv[1];
 	config_file = argv[2];
+	fp.config_file = config_file;
 
 	blocks_file << argv[3] << fp.benchmark << ".blocks";
 	fp.blocks_file = blocks_file.str();
@@ -93,8 +111,11 @@ void IO::parseParametersFiles(FloorPlanner& fp, int const& argc, char** argv) {
 	nets_file << argv[3] << fp.benchmark << ".nets";
 	fp.nets_file = nets_file.str();
 
-	results_file << fp.benchmark << ".results";
-	fp.results.open(results_file.str().c_str());
+	// no results for SA-parameter tuning runs
+	if (IO::mode != IO::Mode::SA_TUNING) {
+		results_file << fp.benchmark << ".results";
+		fp.results.open(results_file.str().c_str());
+	}
 
 	// assume minimal log level; actual level to be parsed later on
 	fp.conf_log = FloorPlanner::LOG_MINIMAL;
@@ -119,8 +140,8 @@ void IO::parseParametersFiles(FloorPlanner& fp, int const& argc, char** argv) {
 	}
 	in.close();
 
-	// alignments file; only considered for regular runs
-	if (IO::mode == IO::Mode::REGULAR) {
+	// alignments file; only considered for regular and SA-parameter tuning runs
+	if (IO::mode == IO::Mode::REGULAR || IO::mode == IO::Mode::SA_TUNING) {
 
 		in.open(fp.alignments_file.c_str());
 		// memorize file availability
@@ -160,7 +181,7 @@ void IO::parseParametersFiles(FloorPlanner& fp, int const& argc, char** argv) {
 		if (IO::mode == IO::Mode::THERMAL_ANALYSIS) {
 			exit(1);
 		}
-		else if (IO::mode == IO::Mode::REGULAR) {
+		else {
 			cout << "IO> Thermal optimization cannot be performed; is deactivated." << endl;
 			cout << endl;
 		}
@@ -178,8 +199,22 @@ void IO::parseParametersFiles(FloorPlanner& fp, int const& argc, char** argv) {
 
 	// additional command-line parameters
 	//
+	// SA-parameter tuning runs; additional parameters for configurations and
+	// runtime weight; no solution files are considered
+	if (IO::mode == IO::Mode::SA_TUNING) {
+
+		fp.tuning_configurations = (argc > 4) ? atoi(argv[4]) : 16;
+		fp.tuning_runtime_weight = (argc > 5) ? atof(argv[5]) : 0.2;
+
+		// sanity check for tuning parameters; racing requires at least two
+		// configurations
+		if (fp.tuning_configurations < 2 || fp.tuning_runtime_weight < 0.0) {
+			cout << "IO> Provide at least two configurations and a positive runtime weight for SA-parameter tuning!" << endl;
+			exit(1);
+		}
+	}
 	// additional parameter for solution file given; consider file for readin
-	if (argc > 4) {
+	else if (argc > 4) {
 
 		solution_file << argv[4];
 		// open file if possible
@@ -202,10 +237,20 @@ void IO::parseParametersFiles(FloorPlanner& fp, int const& argc, char** argv) {
 	if (IO::mode == IO::Mode::THERMAL_ANALYSIS) {
 
 		mask_parameters.TSV_density = atof(argv[5]);
+
+		// optional parameter for in-process fitting of the power-blurring
+		// parameters
+		if (argc > 6) {
+			fp.fitting_iterations = atoi(argv[6]);
+		}
+		else {
+			fp.fitting_iterations = 0;
+		}
 	}
 	// for non-thermal-analysis runs, assume that parameters refer to setup w/o TSVs
 	else {
 		mask_parameters.TSV_density = 0.0;
+		fp.fitting_iterations = 0;
 	}
 
 	// config file parsing
@@ -319,6 +364,16 @@ void IO::parseParametersFiles(FloorPlanner& fp, int const& argc, char** argv) {
 		in >> tmpstr;
 	in >> fp.conf_SA_layout_floorplacement;
 
+	in >> tmpstr;
+	while (tmpstr != "value" && !in.eof())
+		in >> tmpstr;
+	in >> fp.conf_SA_layout_constructive_init;
+
+	in >> tmpstr;
+	while (tmpstr != "value" && !in.eof())
+		in >> tmpstr;
+	in >> fp.conf_SA_layout_mincut_die_assignment;
+
 	in >> tmpstr;
 	while (tmpstr != "value" && !in.eof())
 		in >> tmpstr;
@@ -335,6 +390,117 @@ void IO::parseParametersFiles(FloorPlanner& fp, int const& argc, char** argv) {
 		exit(1);
 	}
 
+	in >> tmpstr;
+	while (tmpstr != "value" && !in.eof())
+		in >> tmpstr;
+	in >> fp.conf_SA_early_termination_steps;
+
+	in >> tmpstr;
+	while (tmpstr != "value" && !in.eof())
+		in >> tmpstr;
+	in >> fp.conf_SA_early_termination_std_dev;
+
+	// sanity check for early-termination parameters
+	if (fp.conf_SA_early_termination_steps < 0 || fp.conf_SA_early_termination_std_dev < 0.0) {
+		cout << "IO> Provide positive SA early-termination parameters or set steps to 0 to disable!" << endl;
+		exit(1);
+	}
+
+	in >> tmpstr;
+	while (tmpstr != "value" && !in.eof())
+		in >> tmpstr;
+	in >> fp.conf_SA_threads;
+
+	// sanity check for threads
+	if (fp.conf_SA_threads < 1) {
+		cout << "IO> Provide at least one worker thread!" << endl;
+		exit(1);
+	}
+
+	in >> tmpstr;
+	while (tmpstr != "value" && !in.eof())
+		in >> tmpstr;
+	in >> fp.conf_SA_speculative_ops;
+
+	in >> tmpstr;
+	while (tmpstr != "value" && !in.eof())
+		in >> tmpstr;
+	in >> fp.conf_SA_layout_cache_size;
+
+	// sanity check for cache size
+	if (fp.conf_SA_layout_cache_size < 0) {
+		cout << "IO> Provide a positive layout-cache size or set size to 0 to disable the layout cache!" << endl;
+		exit(1);
+	}
+
+	in >> tmpstr;
+	while (tmpstr != "value" && !in.eof())
+		in >> tmpstr;
+	in >> fp.conf_SA_Pareto_archive_size;
+
+	// sanity check for archive size
+	if (fp.conf_SA_Pareto_archive_size < 0) {
+		cout << "IO> Provide a positive Pareto-archive size or set size to 0 to disable the Pareto archive!" << endl;
+		exit(1);
+	}
+
+	in >> tmpstr;
+	while (tmpstr != "value" && !in.eof())
+		in >> tmpstr;
+	in >> chains;
+
+	// sanity check for chains
+	if (chains < 0) {
+		cout << "IO> Provide a positive number of multi-weight chains or set number to 0 to disable the chains!" << endl;
+		exit(1);
+	}
+
+	// cost factors of chains, i.e., thermal, WL, TSVs and alignment
+	fp.conf_SA_chains_weights.clear();
+	for (c = 0; c < chains; c++) {
+
+		array<double, 4> weights;
+		in >> weights[0] >> weights[1] >> weights[2] >> weights[3];
+
+		// sanity check for positive cost factors which sum up to approx. 1
+		if (weights[0] < 0.0 || weights[1] < 0.0 || weights[2] < 0.0 || weights[3] < 0.0
+				|| abs(weights[0] + weights[1] + weights[2] + weights[3] - 1.0) > 0.1) {
+			cout << "IO> Provide positive cost factors for multi-weight chain " << c + 1 << ", summing up to approx. 1!" << endl;
+			exit(1);
+		}
+
+		fp.conf_SA_chains_weights.push_back(weights);
+	}
+
+	// sanity check for chains; the layout cache is required for sharing the costs
+	if (chains > 0 && fp.conf_SA_layout_cache_size == 0) {
+		cout << "IO> Multi-weight chains require the layout cache!" << endl;
+		exit(1);
+	}
+
+	in >> tmpstr;
+	while (tmpstr != "value" && !in.eof())
+		in >> tmpstr;
+	in >> fp.conf_SA_targeted_ops_ratio;
+
+	// sanity check for ratio
+	if (fp.conf_SA_targeted_ops_ratio < 0.0 || fp.conf_SA_targeted_ops_ratio > 1.0) {
+		cout << "IO> Provide a targeted-operations ratio within [0, 1], or set ratio to 0 to disable targeted operations!" << endl;
+		exit(1);
+	}
+
+	in >> tmpstr;
+	while (tmpstr != "value" && !in.eof())
+		in >> tmpstr;
+	in >> fp.conf_SA_hierarchical_cluster_size;
+
+	// sanity check for cluster size; clusters w/ only one block are not
+	// reasonable
+	if (fp.conf_SA_hierarchical_cluster_size < 0 || fp.conf_SA_hierarchical_cluster_size == 1) {
+		cout << "IO> Provide a cluster size of at least two blocks or set cluster size to 0 to disable hierarchical floorplanning!" << endl;
+		exit(1);
+	}
+
 	in >> tmpstr;
 	while (tmpstr != "value" && !in.eof())
 		in >> tmpstr;
@@ -407,6 +573,14 @@ void IO::parseParametersFiles(FloorPlanner& fp, int const& argc, char** argv) {
 	// memorize if alignment optimization should be performed
 	fp.conf_SA_opt_alignment = (fp.conf_SA_cost_alignment > 0.0 && fp.alignments_file_avail);
 
+	// multi-weight chains share the optimization flags, i.e., the cost terms
+	// required by any chain are evaluated for all chains
+	for (array<double, 4> const& weights : fp.conf_SA_chains_weights) {
+		fp.conf_SA_opt_thermal = fp.conf_SA_opt_thermal || (weights[0] > 0.0 && fp.power_density_file_avail);
+		fp.conf_SA_opt_interconnects = fp.conf_SA_opt_interconnects || (weights[1] > 0.0 || weights[2] > 0.0);
+		fp.conf_SA_opt_alignment = fp.conf_SA_opt_alignment || (weights[3] > 0.0 && fp.alignments_file_avail);
+	}
+
 	// sanity check for positive cost factors
 	if (fp.conf_SA_cost_thermal < 0.0 || fp.conf_SA_cost_WL < 0.0 || fp.conf_SA_cost_TSVs < 0.0 || fp.conf_SA_cost_alignment < 0.0) {
 		cout << "IO> Provide positive cost factors!" << endl;
@@ -419,6 +593,34 @@ void IO::parseParametersFiles(FloorPlanner& fp, int const& argc, char** argv) {
 		exit(1);
 	}
 
+	// thermal-analysis resolution
+	//
+	in >> tmpstr;
+	while (tmpstr != "value" && !in.eof())
+		in >> tmpstr;
+	in >> fp.conf_power_blurring_thermal_map_dim;
+
+	in >> tmpstr;
+	while (tmpstr != "value" && !in.eof())
+		in >> tmpstr;
+	in >> fp.conf_power_blurring_thermal_mask_dim;
+
+	// sanity check for supported resolution
+	if (!ThermalAnalyzer::supportedResolution(fp.conf_power_blurring_thermal_map_dim, fp.conf_power_blurring_thermal_mask_dim)) {
+		cout << "IO> Provide a supported power-blurring resolution, i.e., thermal-map / thermal-mask dimensions of 32 / 11, 64 / 11, 128 / 15, or 128 / 21!" << endl;
+		exit(1);
+	}
+
+	in >> tmpstr;
+	while (tmpstr != "value" && !in.eof())
+		in >> tmpstr;
+	in >> fp.conf_SA_thermal_multi_resolution;
+
+	in >> tmpstr;
+	while (tmpstr != "value" && !in.eof())
+		in >> tmpstr;
+	in >> fp.conf_power_blurring_single_precision;
+
 	// thermal-analysis parameters
 	//
 	in >> tmpstr;
@@ -474,6 +676,11 @@ void IO::parseParametersFiles(FloorPlanner& fp, int const& argc, char** argv) {
 		exit(1);
 	}
 
+	in >> tmpstr;
+	while (tmpstr != "value" && !in.eof())
+		in >> tmpstr;
+	in >> fp.conf_power_blurring_TSV_density_masks;
+
 	in >> tmpstr;
 	while (tmpstr != "value" && !in.eof())
 		in >> tmpstr;
@@ -488,6 +695,13 @@ void IO::parseParametersFiles(FloorPlanner& fp, int const& argc, char** argv) {
 	// store power-blurring parameters
 	fp.conf_power_blurring_parameters = mask_parameters;
 
+	// grid-based thermal analysis
+	//
+	in >> tmpstr;
+	while (tmpstr != "value" && !in.eof())
+		in >> tmpstr;
+	in >> fp.conf_thermal_solver;
+
 	in.close();
 
 	if (fp.logMin()) {
@@ -509,10 +723,34 @@ void IO::parseParametersFiles(FloorPlanner& fp, int const& argc, char** argv) {
 		cout << "IO>  SA -- Layout generation; packing iterations: " << fp.conf_SA_layout_packing_iterations << endl;
 		cout << "IO>  SA -- Layout generation; power-aware block handling: " << fp.conf_SA_layout_power_aware_block_handling << endl;
 		cout << "IO>  SA -- Layout generation; floorplacement handling: " << fp.conf_SA_layout_floorplacement << endl;
+		cout << "IO>  SA -- Layout generation; constructive initial layout: " << fp.conf_SA_layout_constructive_init << endl;
+		cout << "IO>  SA -- Layout generation; min-cut die assignment: " << fp.conf_SA_layout_mincut_die_assignment << endl;
+		if (fp.conf_SA_layout_mincut_die_assignment && fp.conf_SA_layout_power_aware_block_handling) {
+			cout << "IO>   Note: min-cut die assignment is ignored since power-aware block handling is active" << endl;
+		}
 
 		// SA loop setup
 		cout << "IO>  SA -- Inner-loop operation-factor a (ops = N^a for N blocks): " << fp.conf_SA_loopFactor << endl;
 		cout << "IO>  SA -- Outer-loop upper limit: " << fp.conf_SA_loopLimit << endl;
+		cout << "IO>  SA -- Early termination; temperature steps w/o new best solution: " << fp.conf_SA_early_termination_steps << endl;
+		cout << "IO>  SA -- Early termination; std dev limit of avg cost: " << fp.conf_SA_early_termination_std_dev << endl;
+
+		// SA parallelization
+		cout << "IO>  SA -- Parallelization; worker threads: " << fp.conf_SA_threads << endl;
+		cout << "IO>  SA -- Parallelization; speculative evaluation of layout operations: " << fp.conf_SA_speculative_ops << endl;
+		cout << "IO>  SA -- Layout cache; max entries: " << fp.conf_SA_layout_cache_size << endl;
+		cout << "IO>  SA -- Pareto archive; max solutions: " << fp.conf_SA_Pareto_archive_size << endl;
+		cout << "IO>  SA -- Multi-weight chains: " << fp.conf_SA_chains_weights.size() << endl;
+		for (c = 0; c < static_cast<int>(fp.conf_SA_chains_weights.size()); c++) {
+			cout << "IO>   Chain " << c + 1 << "; cost factors for thermal distribution, wirelength, TSVs, block alignment: ";
+			cout << fp.conf_SA_chains_weights[c][0] << ", " << fp.conf_SA_chains_weights[c][1] << ", ";
+			cout << fp.conf_SA_chains_weights[c][2] << ", " << fp.conf_SA_chains_weights[c][3] << endl;
+		}
+
+		cout << "IO>  SA -- Targeted layout operations; ratio: " << fp.conf_SA_targeted_ops_ratio << endl;
+
+		// SA hierarchical floorplanning
+		cout << "IO>  SA -- Hierarchical floorplanning; max blocks per cluster: " << fp.conf_SA_hierarchical_cluster_size << endl;
 
 		// SA cooling schedule
 		cout << "IO>  SA -- Start temperature scaling factor: " << fp.conf_SA_temp_init_factor << endl;
@@ -533,6 +771,12 @@ void IO::parseParametersFiles(FloorPlanner& fp, int const& argc, char** argv) {
 			cout << "IO>     Note: block alignment is disabled since no alignment-requests file is available" << endl;
 		}
 
+		// power blurring resolution
+		cout << "IO>  Power-blurring resolution -- Thermal-map dimension: " << fp.conf_power_blurring_thermal_map_dim << endl;
+		cout << "IO>  Power-blurring resolution -- Thermal-mask dimension: " << fp.conf_power_blurring_thermal_mask_dim << endl;
+		cout << "IO>  Power-blurring resolution -- Multi-resolution thermal analysis during SA: " << fp.conf_SA_thermal_multi_resolution << endl;
+		cout << "IO>  Power-blurring resolution -- Single-precision convolution: " << fp.conf_power_blurring_single_precision << endl;
+
 		// power blurring mask parameters
 		cout << "IO>  Power-blurring mask parameterization -- TSV density: " << mask_parameters.TSV_density << endl;
 		cout << "IO>  Power-blurring mask parameterization -- Impulse factor: " << mask_parameters.impulse_factor << endl;
@@ -540,8 +784,12 @@ void IO::parseParametersFiles(FloorPlanner& fp, int const& argc, char** argv) {
 		cout << "IO>  Power-blurring mask parameterization -- Mask-boundary value: " << mask_parameters.mask_boundary_value << endl;
 		cout << "IO>  Power-blurring mask parameterization -- Power-density scaling factor (padding zone): " << mask_parameters.power_density_scaling_padding_zone << endl;
 		cout << "IO>  Power-blurring mask parameterization -- Power-density down-scaling factor (TSV regions): " << mask_parameters.power_density_scaling_TSV_region << endl;
+		cout << "IO>  Power-blurring mask parameterization -- TSV-density-aware masks: " << fp.conf_power_blurring_TSV_density_masks << endl;
 		cout << "IO>  Power-blurring mask parameterization -- Temperature offset: " << mask_parameters.temp_offset << endl;
 
+		// grid-based thermal analysis
+		cout << "IO>  Grid-based thermal analysis -- Steady-state analysis of final layouts: " << fp.conf_thermal_solver << endl;
+
 		cout << endl;
 	}
 }
@@ -908,6 +1156,7 @@ void IO::parseBlocks(FloorPlanner& fp) {
 			}
 
 			// store pin
+			new_pin.numerical_id = fp.terminals.size();
 			fp.terminals.push_back(new_pin);
 
 			// reset pins file stream for next search
@@ -1008,6 +1257,7 @@ void IO::parseBlocks(FloorPlanner& fp) {
 		blocks_max_area = max(blocks_max_area, new_block.bb.area);
 
 		// store block
+		new_block.numerical_id = fp.blocks.size();
 		fp.blocks.push_back(move(new_block));
 	}
 
@@ -1070,6 +1320,15 @@ void IO::parseBlocks(FloorPlanner& fp) {
 		exit(1);
 	}
 
+	// sanity check for hierarchical floorplanning, only relevant for regular runs;
+	// the regions are floorplanned separately, each within one layer, thus
+	// thermal optimization and block alignment cannot be considered. Note that
+	// the hierarchical mode depends on the number of blocks
+	if (IO::mode == IO::Mode::REGULAR && !fp.inputSolutionFileOpen() && fp.hierarchicalMode() && (fp.conf_SA_opt_thermal || fp.conf_SA_opt_alignment)) {
+		cout << "IO>  Hierarchical floorplanning does not support thermal optimization or block alignment; set the related cost factors to 0 or disable hierarchical floorplanning!" << endl;
+		exit(1);
+	}
+
 	// logging
 	if (fp.logMed()) {
 		cout << "IO> ";
@@ -1206,7 +1465,8 @@ void IO::parseNets(FloorPlanner& fp) {
 			}
 		}
 
-		// store net
+		// store net, along w/ bounding box of its terminal pins
+		new_net.initTerminalsBoundingBox();
 		fp.nets.push_back(move(new_net));
 
 		// consider next net id
@@ -1252,13 +1512,13 @@ void IO::writePowerThermalTSVMaps(FloorPlanner& fp) {
 	ofstream data_out;
 	int cur_layer;
 	int layer_limit;
-	unsigned x, y;
+	int x, y;
 	enum FLAGS : int {power = 0, thermal = 1, TSV_density = 2};
 	int flag, flag_start, flag_stop;
 	double max_temp, min_temp;
 
 	// sanity check
-	if (fp.thermalAnalyzer.power_maps.empty() || fp.thermalAnalyzer.thermal_map.empty()) {
+	if (fp.thermalAnalyzer.power_density_maps.empty() || fp.thermalAnalyzer.thermal_map.empty()) {
 		return;
 	}
 
@@ -1338,21 +1598,21 @@ void IO::writePowerThermalTSVMaps(FloorPlanner& fp) {
 			// output grid values for power maps
 			if (flag == FLAGS::power) {
 
-				for (x = 0; x < ThermalAnalyzer::POWER_MAPS_DIM; x++) {
-					for (y = 0; y < ThermalAnalyzer::POWER_MAPS_DIM; y++) {
-						data_out << x << "	" << y << "	" << fp.thermalAnalyzer.power_maps[cur_layer][x][y].power_density << endl;
+				for (x = 0; x < fp.thermalAnalyzer.power_maps_dim; x++) {
+					for (y = 0; y < fp.thermalAnalyzer.power_maps_dim; y++) {
+						data_out << x << "	" << y << "	" << fp.thermalAnalyzer.power_density_maps[cur_layer][fp.thermalAnalyzer.bin(x, y)] << endl;
 					}
 
 					// add dummy data point, required since gnuplot option corners2color cuts last row and column of dataset
-					data_out << x << "	" << ThermalAnalyzer::POWER_MAPS_DIM << "	" << "0.0" << endl;
+					data_out << x << "	" << fp.thermalAnalyzer.power_maps_dim << "	" << "0.0" << endl;
 
 					// blank line marks new row for gnuplot
 					data_out << endl;
 				}
 
 				// add dummy data row, required since gnuplot option corners2color cuts last row and column of dataset
-				for (y = 0; y <= ThermalAnalyzer::POWER_MAPS_DIM; y++) {
-					data_out << ThermalAnalyzer::POWER_MAPS_DIM << "	" << y << "	" << "0.0" << endl;
+				for (y = 0; y <= fp.thermalAnalyzer.power_maps_dim; y++) {
+					data_out << fp.thermalAnalyzer.power_maps_dim << "	" << y << "	" << "0.0" << endl;
 				}
 
 			}
@@ -1361,8 +1621,8 @@ void IO::writePowerThermalTSVMaps(FloorPlanner& fp) {
 				max_temp = 0.0;
 				min_temp = 1.0e6;
 
-				for (x = 0; x < ThermalAnalyzer::THERMAL_MAP_DIM; x++) {
-					for (y = 0; y < ThermalAnalyzer::THERMAL_MAP_DIM; y++) {
+				for (x = 0; x < fp.thermalAnalyzer.thermal_map_dim; x++) {
+					for (y = 0; y < fp.thermalAnalyzer.thermal_map_dim; y++) {
 						data_out << x << "	" << y << "	" << fp.thermalAnalyzer.thermal_map[x][y] << endl;
 						// also track max and min temp
 						max_temp = max(max_temp, fp.thermalAnalyzer.thermal_map[x][y]);
@@ -1370,38 +1630,38 @@ void IO::writePowerThermalTSVMaps(FloorPlanner& fp) {
 					}
 
 					// add dummy data point, required since gnuplot option corners2color cuts last row and column of dataset
-					data_out << x << "	" << ThermalAnalyzer::THERMAL_MAP_DIM << "	" << "0.0" << endl;
+					data_out << x << "	" << fp.thermalAnalyzer.thermal_map_dim << "	" << "0.0" << endl;
 
 					// blank line marks new row for gnuplot
 					data_out << endl;
 				}
 
 				// add dummy data row, required since gnuplot option corners2color cuts last row and column of dataset
-				for (y = 0; y <= ThermalAnalyzer::THERMAL_MAP_DIM; y++) {
-					data_out << ThermalAnalyzer::THERMAL_MAP_DIM << "	" << y << "	" << "0.0" << endl;
+				for (y = 0; y <= fp.thermalAnalyzer.thermal_map_dim; y++) {
+					data_out << fp.thermalAnalyzer.thermal_map_dim << "	" << y << "	" << "0.0" << endl;
 				}
 			}
 			// output grid values for TSV-density maps; consider only bin bins
 			// w/in die outline, not in padded zone
 			else if (flag == FLAGS::TSV_density) {
 
-				for (x = 0; x < ThermalAnalyzer::THERMAL_MAP_DIM; x++) {
-					for (y = 0; y < ThermalAnalyzer::THERMAL_MAP_DIM; y++) {
+				for (x = 0; x < fp.thermalAnalyzer.thermal_map_dim; x++) {
+					for (y = 0; y < fp.thermalAnalyzer.thermal_map_dim; y++) {
 						// access map bins w/ offset related to
 						// padding zone
-						data_out << x << "	" << y << "	" << fp.thermalAnalyzer.power_maps[cur_layer][x + ThermalAnalyzer::POWER_MAPS_PADDED_BINS][y + ThermalAnalyzer::POWER_MAPS_PADDED_BINS].TSV_density << endl;
+						data_out << x << "	" << y << "	" << fp.thermalAnalyzer.TSV_density_maps[cur_layer][fp.thermalAnalyzer.bin(x + fp.thermalAnalyzer.power_maps_padded_bins, y + fp.thermalAnalyzer.power_maps_padded_bins)] << endl;
 					}
 
 					// add dummy data point, required since gnuplot option corners2color cuts last row and column of dataset
-					data_out << x << "	" << ThermalAnalyzer::THERMAL_MAP_DIM << "	" << "0.0" << endl;
+					data_out << x << "	" << fp.thermalAnalyzer.thermal_map_dim << "	" << "0.0" << endl;
 
 					// blank line marks new row for gnuplot
 					data_out << endl;
 				}
 
 				// add dummy data row, required since gnuplot option corners2color cuts last row and column of dataset
-				for (y = 0; y <= ThermalAnalyzer::THERMAL_MAP_DIM; y++) {
-					data_out << ThermalAnalyzer::THERMAL_MAP_DIM << "	" << y << "	" << "0.0" << endl;
+				for (y = 0; y <= fp.thermalAnalyzer.thermal_map_dim; y++) {
+					data_out << fp.thermalAnalyzer.thermal_map_dim << "	" << y << "	" << "0.0" << endl;
 				}
 			}
 
@@ -1427,12 +1687,12 @@ void IO::writePowerThermalTSVMaps(FloorPlanner& fp) {
 			// column, since gnuplot option corners2color cuts off last row
 			// and column
 			if (flag == FLAGS::power) {
-				gp_out << "set xrange [0:" << ThermalAnalyzer::POWER_MAPS_DIM << "]" << endl;
-				gp_out << "set yrange [0:" << ThermalAnalyzer::POWER_MAPS_DIM << "]" << endl;
+				gp_out << "set xrange [0:" << fp.thermalAnalyzer.power_maps_dim << "]" << endl;
+				gp_out << "set yrange [0:" << fp.thermalAnalyzer.power_maps_dim << "]" << endl;
 			}
 			else if (flag == FLAGS::thermal	|| flag == FLAGS::TSV_density) {
-				gp_out << "set xrange [0:" << ThermalAnalyzer::THERMAL_MAP_DIM << "]" << endl;
-				gp_out << "set yrange [0:" << ThermalAnalyzer::THERMAL_MAP_DIM << "]" << endl;
+				gp_out << "set xrange [0:" << fp.thermalAnalyzer.thermal_map_dim << "]" << endl;
+				gp_out << "set yrange [0:" << fp.thermalAnalyzer.thermal_map_dim << "]" << endl;
 			}
 
 			// power maps: scale, label for cbrange
@@ -1485,11 +1745,11 @@ void IO::writePowerThermalTSVMaps(FloorPlanner& fp) {
 			gp_out << "8 \"#7f0000\")" << endl;
 
 			// for padded power maps: draw rectangle for unpadded core
-			if (flag == FLAGS::power && ThermalAnalyzer::POWER_MAPS_PADDED_BINS > 0) {
+			if (flag == FLAGS::power && fp.thermalAnalyzer.power_maps_padded_bins > 0) {
 				gp_out << "set obj 1 rect from ";
-				gp_out << ThermalAnalyzer::POWER_MAPS_PADDED_BINS << ", " << ThermalAnalyzer::POWER_MAPS_PADDED_BINS << " to ";
-				gp_out << ThermalAnalyzer::POWER_MAPS_DIM - ThermalAnalyzer::POWER_MAPS_PADDED_BINS << ", ";
-				gp_out << ThermalAnalyzer::POWER_MAPS_DIM - ThermalAnalyzer::POWER_MAPS_PADDED_BINS << " ";
+				gp_out << fp.thermalAnalyzer.power_maps_padded_bins << ", " << fp.thermalAnalyzer.power_maps_padded_bins << " to ";
+				gp_out << fp.thermalAnalyzer.power_maps_dim - fp.thermalAnalyzer.power_maps_padded_bins << ", ";
+				gp_out << fp.thermalAnalyzer.power_maps_dim - fp.thermalAnalyzer.power_maps_padded_bins << " ";
 				gp_out << "front fillstyle empty border rgb \"white\" linewidth 3" << endl;
 			}
 
@@ -2158,6 +2418,294 @@ void IO::writeFloorplanGP(FloorPlanner const& fp, vector<CorblivarAlignmentReq>
 }
 
 // generate files for HotSpot steady-state thermal simulation
+// results of grid-based thermal analysis; written in the format of HotSpot's steady-state
+// grid files, i.e., they can be handled like results of HotSpot runs, e.g., by the Octave
+// scripts for thermal-analysis fitting. Note that layer ids follow the HotSpot stack, see
+// writeHotSpotFiles
+void IO::writeThermalSolverMaps(FloorPlanner const& fp) {
+	ofstream file;
+	int cur_layer;
+	int x, y;
+	int row, dim;
+
+	// sanity check
+	if (fp.thermalSolver.thermal_maps.empty()) {
+		return;
+	}
+
+	if (fp.logMed()) {
+		cout << "IO> Generating files for results of grid-based thermal analysis..." << endl;
+	}
+
+	dim = fp.thermalSolver.grid_dim;
+
+	for (cur_layer = 0; cur_layer < fp.conf_layers; cur_layer++) {
+
+		// build up file name; consider id of active Si layer in HotSpot stack
+		stringstream grid_file;
+		grid_file << fp.benchmark << "_HotSpot.steady.grid.layer_" << ThermalSolver::LAYERS_PER_DIE * cur_layer + ThermalSolver::LAYER_SI_ACTIVE;
+
+		// init file stream
+		file.open(grid_file.str().c_str());
+
+		// HotSpot grid order; rows are ordered from upper to lower die boundary
+		for (row = 0; row < dim; row++) {
+
+			y = dim - 1 - row;
+
+			for (x = 0; x < dim; x++) {
+				file << row * dim + x << "	" << fp.thermalSolver.thermal_maps[cur_layer][x][y] << endl;
+			}
+		}
+
+		// close file stream
+		file.close();
+	}
+
+	if (fp.logMed()) {
+		cout << "IO> Done" << endl << endl;
+	}
+}
+
+// each archived solution is written as separate solution file; the summary table lists
+// the solutions' actual values of the objectives, as reevaluated for finalization
+void IO::writeParetoArchive(FloorPlanner const& fp) {
+	ofstream summary_out, solution_out;
+	stringstream summary_file;
+	vector<FloorPlanner::ParetoSolution const*> solutions;
+	unsigned s;
+
+	if (fp.logMed()) {
+		cout << "IO> ";
+		cout << "Writing Pareto archive; " << fp.Pareto_archive.size() << " non-dominated solutions ..." << endl;
+	}
+
+	// list solutions by HPWL
+	for (FloorPlanner::ParetoSolution const& sol : fp.Pareto_archive) {
+		solutions.push_back(&sol);
+	}
+	sort(solutions.begin(), solutions.end(), [](FloorPlanner::ParetoSolution const* s1, FloorPlanner::ParetoSolution const* s2) {
+		return s1->cost.HPWL_actual_value < s2->cost.HPWL_actual_value;
+	});
+
+	summary_file << fp.benchmark << "_Pareto.data";
+	summary_out.open(summary_file.str().c_str());
+
+	summary_out << "# Pareto archive; non-dominated fitting solutions found during SA" << endl;
+	summary_out << "# Solution_file HPWL TSVs Temp_(estimated_max_temp_for_lowest_layer_[K]) Alignment_mismatches_[um] SA_step" << endl;
+
+	for (s = 0; s < solutions.size(); s++) {
+		stringstream solution_file;
+
+		solution_file << fp.benchmark << "_Pareto_" << s + 1 << ".solution";
+
+		solution_out.open(solution_file.str().c_str());
+		solution_out << solutions[s]->solution << endl;
+		solution_out.close();
+
+		summary_out << solution_file.str();
+		summary_out << " " << solutions[s]->cost.HPWL_actual_value;
+		summary_out << " " << solutions[s]->cost.TSVs_actual_value;
+		summary_out << " " << solutions[s]->cost.thermal_actual_value;
+		summary_out << " " << solutions[s]->cost.alignments_actual_value;
+		summary_out << " " << solutions[s]->step;
+		summary_out << endl;
+	}
+
+	summary_out.close();
+
+	if (fp.logMed()) {
+		cout << "IO> Done" << endl << endl;
+	}
+}
+
+// each chain's best solution is written as separate solution file; the summary table
+// lists the chains' cost factors and the actual values of the related cost terms, as
+// reevaluated for finalization
+void IO::writeSAChains(FloorPlanner const& fp) {
+	ofstream summary_out, solution_out;
+	stringstream summary_file;
+	unsigned c;
+
+	if (fp.logMed()) {
+		cout << "IO> ";
+		cout << "Writing best solutions of " << fp.SA_chains.size() << " multi-weight chains ..." << endl;
+	}
+
+	summary_file << fp.benchmark << "_chains.data";
+	summary_out.open(summary_file.str().c_str());
+
+	summary_out << "# Multi-weight chains; best fitting solutions for further cost factors" << endl;
+	summary_out << "# Solution_file Cost_factor_thermal Cost_factor_WL Cost_factor_TSVs Cost_factor_alignment";
+	summary_out << " HPWL TSVs Temp_(estimated_max_temp_for_lowest_layer_[K]) Alignment_mismatches_[um]" << endl;
+
+	for (c = 0; c < fp.SA_chains.size(); c++) {
+		FloorPlanner::SAChain const& chain = fp.SA_chains[c];
+		stringstream solution_file;
+
+		// chains w/o fitting solution are skipped
+		if (!chain.valid_layout_found) {
+			continue;
+		}
+
+		solution_file << fp.benchmark << "_chain_" << c + 1 << ".solution";
+
+		solution_out.open(solution_file.str().c_str());
+		solution_out << chain.solution << endl;
+		solution_out.close();
+
+		summary_out << solution_file.str();
+		for (double const& weight : fp.conf_SA_chains_weights[c]) {
+			summary_out << " " << weight;
+		}
+		summary_out << " " << chain.cost.HPWL_actual_value;
+		summary_out << " " << chain.cost.TSVs_actual_value;
+		summary_out << " " << chain.cost.thermal_actual_value;
+		summary_out << " " << chain.cost.alignments_actual_value;
+		summary_out << endl;
+	}
+
+	summary_out.close();
+
+	if (fp.logMed()) {
+		cout << "IO> Done" << endl << endl;
+	}
+}
+
+void IO::writeFittedConfig(FloorPlanner const& fp) {
+	stringstream fitted_file;
+	ThermalAnalyzer::MaskParameters const& parameters = fp.conf_power_blurring_parameters;
+	// comments of config entries to be replaced, along w/ fitted values
+	vector< pair<string, double> > const entries = {
+		{"# Impulse factor I", parameters.impulse_factor},
+		{"# Impulse-scaling factor If", parameters.impulse_factor_scaling_exponent},
+		{"# Mask-boundary /value/ b", parameters.mask_boundary_value},
+		{"# Power-density scaling factor in padding zone", parameters.power_density_scaling_padding_zone},
+		{"# Power-density down-scaling factor for TSV regions", parameters.power_density_scaling_TSV_region},
+		{"# Temperature offset", parameters.temp_offset}
+	};
+
+	fitted_file << fp.benchmark << ".fitted.conf";
+
+	if (fp.logMin()) {
+		cout << "IO> Writing config file w/ fitted power-blurring parameters: " << fitted_file.str() << endl;
+	}
+
+	IO::writeConfig(fp, fitted_file.str(), entries);
+
+	if (fp.logMin()) {
+		cout << "IO> Done" << endl << endl;
+	}
+}
+
+// the tuned config file and the summary of all configurations are named after the
+// config file, since the tuning refers to a set of benchmarks
+void IO::writeTunedConfig(FloorPlanner const& fp) {
+	ofstream summary_out;
+	stringstream tuned_file, summary_file;
+	string config_name;
+	unsigned c;
+	// comments of config entries to be replaced, along w/ tuned values
+	vector< pair<string, double> > const entries = {
+		{"# Inner-loop operation-factor a", fp.conf_SA_loopFactor},
+		{"# Start temperature scaling factor", fp.conf_SA_temp_init_factor},
+		{"# Initial temperature-scaling factor for phase 1", fp.conf_SA_temp_factor_phase1},
+		{"# Final temperature-scaling factor for phase 1", fp.conf_SA_temp_factor_phase1_limit},
+		{"# Temperature-scaling factor for phase 2", fp.conf_SA_temp_factor_phase2},
+		{"# Temperature-scaling factor for phase 3", fp.conf_SA_temp_factor_phase3}
+	};
+
+	// config name w/o path and extension
+	config_name = fp.config_file.substr(fp.config_file.find_last_of('/') + 1);
+	if (config_name.length() > 5 && config_name.compare(config_name.length() - 5, 5, ".conf") == 0) {
+		config_name.erase(config_name.length() - 5);
+	}
+
+	tuned_file << config_name << ".tuned.conf";
+	summary_file << config_name << ".tuning.data";
+
+	if (fp.logMin()) {
+		cout << "IO> Writing config file w/ tuned SA parameters: " << tuned_file.str() << endl;
+	}
+
+	IO::writeConfig(fp, tuned_file.str(), entries);
+
+	// summary of all configurations
+	summary_out.open(summary_file.str().c_str());
+
+	summary_out << "# SA-parameter tuning; configuration " << fp.tuning_best << " is tuned, configuration 0 refers to the configured parameters" << endl;
+	summary_out << "# Configuration Inner-loop_operation-factor Start_temperature-scaling_factor Temperature-scaling_factors_phase_1_(initial,final)";
+	summary_out << " Temperature-scaling_factor_phase_2 Temperature-scaling_factor_phase_3 Runs Avg_objective Dropped_in_round" << endl;
+
+	for (c = 0; c < fp.tuning_configs.size(); c++) {
+
+		summary_out << c;
+		for (double const& parameter : fp.tuning_configs[c].point) {
+			summary_out << " " << parameter;
+		}
+		summary_out << " " << fp.tuning_configs[c].objectives.size();
+		summary_out << " " << fp.tuning_configs[c].avg_objective;
+		summary_out << " " << fp.tuning_configs[c].dropped;
+		summary_out << endl;
+	}
+
+	summary_out.close();
+
+	if (fp.logMin()) {
+		cout << "IO> Done" << endl << endl;
+	}
+}
+
+void IO::writeConfig(FloorPlanner const& fp, string const& file, vector< pair<string, double> > const& entries) {
+	ifstream in;
+	ofstream out;
+	string line;
+	int entry;
+	bool value_line;
+
+	in.open(fp.config_file.c_str());
+	out.open(file.c_str());
+
+	// copy config file line by line; the value lines of the entries to be
+	// replaced follow the lines ``value'' below the entries' comments
+	entry = -1;
+	value_line = false;
+	while (getline(in, line)) {
+
+		if (value_line) {
+			stringstream value;
+
+			value << entries[entry].second;
+			// retain padding of original line
+			if (value.str().length() < line.length()) {
+				value << string(line.length() - value.str().length(), ' ');
+			}
+			out << value.str() << endl;
+
+			entry = -1;
+			value_line = false;
+			continue;
+		}
+
+		out << line << endl;
+
+		// new comment; check for entries to be replaced
+		if (line.compare(0, 2, "# ") == 0) {
+			for (unsigned e = 0; e < entries.size(); e++) {
+				if (line.compare(0, entries[e].first.length(), entries[e].first) == 0) {
+					entry = e;
+				}
+			}
+		}
+		else if (entry != -1 && line.compare(0, 5, "value") == 0) {
+			value_line = true;
+		}
+	}
+
+	in.close();
+	out.close();
+}
+
 void IO::writeHotSpotFiles(FloorPlanner const& fp) {
 	ofstream file, file_bond;
 	int cur_layer;
@@ -2240,19 +2788,19 @@ void IO::writeHotSpotFiles(FloorPlanner const& fp) {
 		file_bond << "# comments and empty lines are ignored" << endl;
 
 		// for regular runs, i.e., Corblivar runs, we have to consider different
-		// TSV densities for each grid bin, given in the power_maps
+		// TSV densities for each grid bin, given in the TSV-density maps
 		if (IO::mode == IO::Mode::REGULAR) {
 
 			// walk power-map grid to obtain specific TSV densities of bins
-			for (x = ThermalAnalyzer::POWER_MAPS_PADDED_BINS; x < ThermalAnalyzer::THERMAL_MAP_DIM + ThermalAnalyzer::POWER_MAPS_PADDED_BINS; x++) {
+			for (x = fp.thermalAnalyzer.power_maps_padded_bins; x < fp.thermalAnalyzer.thermal_map_dim + fp.thermalAnalyzer.power_maps_padded_bins; x++) {
 
 				// adapt index for final thermal map according to padding
-				map_x = x - ThermalAnalyzer::POWER_MAPS_PADDED_BINS;
+				map_x = x - fp.thermalAnalyzer.power_maps_padded_bins;
 
-				for (y = ThermalAnalyzer::POWER_MAPS_PADDED_BINS; y < ThermalAnalyzer::THERMAL_MAP_DIM + ThermalAnalyzer::POWER_MAPS_PADDED_BINS; y++) {
+				for (y = fp.thermalAnalyzer.power_maps_padded_bins; y < fp.thermalAnalyzer.thermal_map_dim + fp.thermalAnalyzer.power_maps_padded_bins; y++) {
 
 					// adapt index for final thermal map according to padding
-					map_y = y - ThermalAnalyzer::POWER_MAPS_PADDED_BINS;
+					map_y = y - fp.thermalAnalyzer.power_maps_padded_bins;
 
 					// put grid block as floorplan blocks; passive Si layer
 					file << "Si_passive_" << cur_layer + 1 << "_" << map_x << ":" << map_y;
@@ -2264,8 +2812,8 @@ void IO::writeHotSpotFiles(FloorPlanner const& fp) {
 					file << "	" << static_cast<float>(map_x * fp.thermalAnalyzer.power_maps_dim_x * IO::SCALE_UM_M);
 					file << "	" << static_cast<float>(map_y * fp.thermalAnalyzer.power_maps_dim_x * IO::SCALE_UM_M);
 					// thermal properties, depending on bin's TSV density
-					file << "	" << ThermalAnalyzer::heatCapSi(fp.thermalAnalyzer.power_maps[cur_layer][x][y].TSV_density);
-					file << "	" << ThermalAnalyzer::thermResSi(fp.thermalAnalyzer.power_maps[cur_layer][x][y].TSV_density);
+					file << "	" << ThermalAnalyzer::heatCapSi(fp.thermalAnalyzer.TSV_density_maps[cur_layer][fp.thermalAnalyzer.bin(x, y)]);
+					file << "	" << ThermalAnalyzer::thermResSi(fp.thermalAnalyzer.TSV_density_maps[cur_layer][fp.thermalAnalyzer.bin(x, y)]);
 					file << endl;
 
 					// put grid block as floorplan blocks; bonding layer
@@ -2278,8 +2826,8 @@ void IO::writeHotSpotFiles(FloorPlanner const& fp) {
 					file_bond << "	" << static_cast<float>(map_x * fp.thermalAnalyzer.power_maps_dim_x * IO::SCALE_UM_M);
 					file_bond << "	" << static_cast<float>(map_y * fp.thermalAnalyzer.power_maps_dim_x * IO::SCALE_UM_M);
 					// thermal properties, depending on bin's TSV density
-					file_bond << "	" << ThermalAnalyzer::heatCapBond(fp.thermalAnalyzer.power_maps[cur_layer][x][y].TSV_density);
-					file_bond << "	" << ThermalAnalyzer::thermResBond(fp.thermalAnalyzer.power_maps[cur_layer][x][y].TSV_density);
+					file_bond << "	" << ThermalAnalyzer::heatCapBond(fp.thermalAnalyzer.TSV_density_maps[cur_layer][fp.thermalAnalyzer.bin(x, y)]);
+					file_bond << "	" << ThermalAnalyzer::thermResBond(fp.thermalAnalyzer.TSV_density_maps[cur_layer][fp.thermalAnalyzer.bin(x, y)]);
 					file_bond << endl;
 				}
 			}
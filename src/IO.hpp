@@ -38,11 +38,15 @@ class IO {
 
 	// private data, functions
 	private:
-		static constexpr int CONFIG_VERSION = 13;
+		static constexpr int CONFIG_VERSION = 27;
 
 		// factor to scale um downto m;
 		static constexpr double SCALE_UM_M = 1.0e-06;
 
+		// copy config file, w/ the values of the given entries replaced; the
+		// entries are identified by the beginning of their comment lines
+		static void writeConfig(FloorPlanner const& fp, string const& file, vector< pair<string, double> > const& entries);
+
 	// constructors, destructors, if any non-implicit
 	// private in order to avoid instances of ``static'' class
 	private:
@@ -51,7 +55,7 @@ class IO {
 
 	// public data, functions
 	public:
-		enum class Mode : unsigned {REGULAR, THERMAL_ANALYSIS};
+		enum class Mode : unsigned {REGULAR, THERMAL_ANALYSIS, SA_TUNING};
 		static Mode mode;
 
 		static void parseParametersFiles(FloorPlanner& fp, int const& argc, char** argv);
@@ -61,6 +65,11 @@ class IO {
 		static void parseCorblivarFile(FloorPlanner& fp, CorblivarCore& corb);
 		static void writeFloorplanGP(FloorPlanner const& fp, vector<CorblivarAlignmentReq> const& alignment, string const& file_suffix = "");
 		static void writeHotSpotFiles(FloorPlanner const& fp);
+		static void writeThermalSolverMaps(FloorPlanner const& fp);
+		static void writeFittedConfig(FloorPlanner const& fp);
+		static void writeTunedConfig(FloorPlanner const& fp);
+		static void writeParetoArchive(FloorPlanner const& fp);
+		static void writeSAChains(FloorPlanner const& fp);
 		// non-const reference due to map acces via []
 		static void writePowerThermalTSVMaps(FloorPlanner& fp);
 		static void writeTempSchedule(FloorPlanner const& fp);
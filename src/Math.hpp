@@ -34,6 +34,12 @@ class Math {
 
 	// private data, functions
 	private:
+		// current random-number engine of the calling thread; nullptr refers
+		// to the thread's own engine, see randomEngine()
+		inline static mt19937*& curRandomEngine() {
+			thread_local mt19937* engine = nullptr;
+			return engine;
+		};
 
 	// constructors, destructors, if any non-implicit
 	// private in order to avoid instances of ``static'' class
@@ -43,6 +49,44 @@ class Math {
 
 	// public data, functions
 	public:
+		// random-number engine; each thread draws from its current engine, i.e.,
+		// from its own engine, seeded w/ time and thread id, or from the engine
+		// of the floorplanner (worker) it is processing, see RandomEngineScope.
+		// Thus, threads never share an engine, and the random numbers of any
+		// floorplanner depend only on the seed of its engine
+		typedef mt19937 RandomEngine;
+
+		inline static RandomEngine& randomEngine() {
+			thread_local RandomEngine thread_engine(static_cast<unsigned>(time(0)) ^ static_cast<unsigned>(std::hash<thread::id>()(this_thread::get_id())));
+
+			if (Math::curRandomEngine() != nullptr) {
+				return *Math::curRandomEngine();
+			}
+			else {
+				return thread_engine;
+			}
+		};
+
+		// applies the given engine as current engine of the calling thread for
+		// the lifetime of the scope, e.g., while processing a task on a worker
+		// thread; the previous engine is restored afterwards
+		class RandomEngineScope {
+			private:
+				RandomEngine* prev;
+
+			public:
+				RandomEngineScope(RandomEngine& engine) {
+					this->prev = Math::curRandomEngine();
+					Math::curRandomEngine() = &engine;
+				};
+				~RandomEngineScope() {
+					Math::curRandomEngine() = this->prev;
+				};
+
+				RandomEngineScope(RandomEngineScope const&) = delete;
+				RandomEngineScope& operator= (RandomEngineScope const&) = delete;
+		};
+
 		// random-number functions
 		// note: range is [min, max)
 		inline static int randI(int const& min, int const& max) {
@@ -50,17 +94,20 @@ class Math {
 				return min;
 			}
 			else {
-				return min + (rand() % (max - min));
+				return min + static_cast<int>(Math::randomEngine()() % static_cast<unsigned>(max - min));
 			}
 		};
 		inline static bool randB() {
-			int const r = rand();
-			return (r < (RAND_MAX / 2));
+			return (Math::randomEngine()() & 1u);
 		};
 		inline static double randF(double const& min, double const& max) {
-			double const r = static_cast<double>(rand()) / RAND_MAX;
+			double const r = static_cast<double>(Math::randomEngine()()) / RandomEngine::max();
 			return r * (max - min) + min;
 		};
+		// seed for further engines, drawn from the current engine
+		inline static unsigned randSeed() {
+			return static_cast<unsigned>(Math::randomEngine()());
+		};
 
 		// standard deviation of samples
 		inline static double stdDev(vector<double> const& samples) {
@@ -89,6 +136,16 @@ class Math {
 			return factor * exp(-(1.0 / spread) * pow(value, 2.0));
 		};
 
+		// hash mixing of 64-bit values, according to the finalizer of
+		// splitmix64; provides well-distributed hashes even for sequential
+		// values, e.g., for Zobrist-style hashing via XOR
+		inline static unsigned long long hash(unsigned long long value) {
+			value += 0x9e3779b97f4a7c15ULL;
+			value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ULL;
+			value = (value ^ (value >> 27)) * 0x94d049bb133111ebULL;
+			return value ^ (value >> 31);
+		};
+
 		// comparison of double values, allows minor deviation
 		inline static bool doubleComp(double const& d1, double const& d2, double const& precision = 1.0e-03) {
 			return abs(d1 - d2) < precision;
@@ -37,6 +37,32 @@ class Net {
 
 	// private data, functions
 	private:
+		// cached geometry, see updateBoundingBoxes(); bounding boxes of the
+		// net's blocks on each layer, along w/ the blocks count
+		mutable vector<Rect> blocks_bbs;
+		mutable vector<int> blocks_count;
+		// cached bounding boxes for interconnects on each layer, as provided
+		// by boundingBox()
+		mutable vector<Rect> bbs;
+
+		// bounding box of terminal pins; static, i.e., only to be updated
+		// when pins are parsed or rescaled
+		Rect terminals_bb;
+
+		// extend bounding box bb by box r; an undefined bb is initialized w/ r
+		inline static void extendBoundingBox(Rect& bb, Rect const& r, bool const& undef) {
+
+			if (undef) {
+				bb.ll = r.ll;
+				bb.ur = r.ur;
+			}
+			else {
+				bb.ll.x = min(bb.ll.x, r.ll.x);
+				bb.ll.y = min(bb.ll.y, r.ll.y);
+				bb.ur.x = max(bb.ur.x, r.ur.x);
+				bb.ur.y = max(bb.ur.y, r.ur.y);
+			}
+		};
 
 	// constructors, destructors, if any non-implicit
 	public:
@@ -70,90 +96,111 @@ class Net {
 			}
 		};
 
+		// determine bounding box of terminal pins; to be called whenever the
+		// terminals are assigned or the pins are moved
+		inline void initTerminalsBoundingBox() {
+
+			this->terminals_bb = Rect();
 
-		inline Rect determBoundingBox(int const& layer) const {
-			int i;
-			vector<Rect const*> blocks_to_consider;
-			bool blocks_above_considered;
-			// dummy return value
+			for (unsigned p = 0; p < this->terminals.size(); p++) {
+				Net::extendBoundingBox(this->terminals_bb, this->terminals[p]->bb, p == 0);
+			}
+		};
+
+		// determine layer boundaries and bounding boxes on all layers for the
+		// current placement of the net's blocks, in one pass over the blocks;
+		// the bounding boxes are cached, i.e., all consumers for the same
+		// placement, like the interconnects evaluation and the thermal
+		// analysis, can refer to boundingBox() afterwards
+		inline void updateBoundingBoxes(int const& layers) const {
+			int layer, layer_above;
+			int count;
 			Rect bb;
 
-			if (Net::DBG) {
-				cout << "DBG_NET>   Determine bb for net " << this->id << " on layer " << layer << endl;
+			this->blocks_bbs.assign(layers, Rect());
+			this->blocks_count.assign(layers, 0);
+			this->bbs.assign(layers, Rect());
+
+			if (this->blocks.empty()) {
+				return;
 			}
 
-			// blocks / pins for cur_net on this layer
+			this->layer_bottom = this->layer_top = this->blocks[0]->layer;
+
 			for (Block const* b : this->blocks) {
 
-				// blocks
-				if (b->layer == layer) {
-					blocks_to_consider.push_back(&b->bb);
+				this->layer_bottom = min(this->layer_bottom, b->layer);
+				this->layer_top = max(this->layer_top, b->layer);
 
-					if (Net::DBG) {
-						cout << "DBG_NET> 	Consider block " << b->id << " on layer " << layer << endl;
-					}
+				Net::extendBoundingBox(this->blocks_bbs[b->layer], b->bb, this->blocks_count[b->layer] == 0);
+				this->blocks_count[b->layer]++;
+			}
+
+			// determine bounding boxes from the uppermost layer downwards; thus
+			// the next layer above w/ any blocks is known for each layer
+			layer_above = -1;
+			for (layer = this->layer_top; layer >= 0; layer--) {
+
+				if (Net::DBG) {
+					cout << "DBG_NET>   Determine bb for net " << this->id << " on layer " << layer << endl;
 				}
 
-				// also consider routes to terminal pins; only on lowest
-				// die of stack since connections b/w terminal pins and
-				// blocks on upper dies are routed through the TSV in that
-				// lowermost die
-				if (layer == 0) {
-					for (Pin const* pin :  this->terminals) {
-						blocks_to_consider.push_back(&pin->bb);
+				// blocks / pins for net on this layer
+				count = this->blocks_count[layer];
+				bb = this->blocks_bbs[layer];
 
-						if (Net::DBG) {
-							cout << "DBG_NET> 	Consider terminal pin " << pin->id << endl;
-						}
-					}
+				// also consider routes to terminal pins; only on lowest die
+				// of stack since connections b/w terminal pins and blocks on
+				// upper dies are routed through the TSV in that lowermost die
+				if (layer == 0 && !this->terminals.empty()) {
+					Net::extendBoundingBox(bb, this->terminals_bb, count == 0);
+					count += this->terminals.size();
 				}
-			}
-			// ignore cases with no blocks on current layer
-			if (blocks_to_consider.empty()) {
-				return bb;
-			}
 
-			// blocks on the layer above; required to assume a reasonable
-			// bounding box on current layer w/o actual placement of TSVs; the
-			// layer to consider is not necessarily the adjacent one, thus
-			// stepwise consider layers until some blocks are found
-			blocks_above_considered = false;
-			i = layer + 1;
-			while (i <= this->layer_top) {
-				for (Block const* b : this->blocks) {
-					if (b->layer == i) {
-						blocks_to_consider.push_back(&b->bb);
-						blocks_above_considered = true;
+				// ignore cases with no blocks on current layer; the bb remains
+				// empty
+				if (count > 0) {
+
+					// blocks on the next layer above w/ any blocks; required
+					// to assume a reasonable bounding box on current layer
+					// w/o actual placement of TSVs
+					if (layer_above != -1) {
+						Net::extendBoundingBox(bb, this->blocks_bbs[layer_above], false);
+						count += this->blocks_count[layer_above];
+					}
+
+					// ignore cases where only one block on the uppermost
+					// layer needs to be considered; these cases are already
+					// covered while considering layers below
+					if (count == 1 && layer == this->layer_top) {
 
 						if (Net::DBG) {
-							cout << "DBG_NET> 	Consider block " << b->id << " on layer " << i << endl;
+							cout << "DBG_NET> 	Ignore single block on uppermost layer" << endl;
 						}
 					}
-				}
+					else {
+						bb.w = bb.ur.x - bb.ll.x;
+						bb.h = bb.ur.y - bb.ll.y;
+						bb.area = bb.w * bb.h;
 
-				// loop handler
-				if (blocks_above_considered) {
-					break;
-				}
-				else {
-					i++;
+						this->bbs[layer] = bb;
+					}
 				}
-			}
-
-			// ignore cases where only one block on the uppermost
-			// layer needs to be considered; these cases are already
-			// covered while considering layers below
-			if (blocks_to_consider.size() == 1 && layer == this->layer_top) {
 
-				if (Net::DBG) {
-					cout << "DBG_NET> 	Ignore single block on uppermost layer" << endl;
+				if (this->blocks_count[layer] > 0) {
+					layer_above = layer;
 				}
-
-				return bb;
 			}
+		};
 
-			return Rect::determBoundingBox(blocks_to_consider);
-		}
+		// bounding box on the layer, as determined by the last call of
+		// updateBoundingBoxes(); the bounding box covers the net's blocks
+		// (and terminal pins, for the lowest layer) on this layer and the
+		// blocks on the next layer above w/ any blocks. The bounding box is
+		// empty for layers w/o any blocks
+		inline Rect const& boundingBox(int const& layer) const {
+			return this->bbs[layer];
+		};
 };
 
 #endif
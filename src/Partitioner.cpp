@@ -0,0 +1,683 @@
+/*
+ * =====================================================================================
+ *
+ *    Description:  Corblivar min-cut partitioner, multi-level Fiduccia-Mattheyses
+ *
+ *    Copyright (C) 2013 Johann Knechtel, johann.knechtel@ifte.de, www.ifte.de
+ *
+ *    This file is part of Corblivar.
+ *    
+ *    Corblivar is free software: you can redistribute it and/or modify it under the terms
+ *    of the GNU General Public License as published by the Free Software Foundation,
+ *    either version 3 of the License, or (at your option) any later version.
+ *    
+ *    Corblivar is distributed in the hope that it will be useful, but WITHOUT ANY
+ *    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *    PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *    
+ *    You should have received a copy of the GNU General Public License along with
+ *    Corblivar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * =====================================================================================
+ */
+
+// own Corblivar header
+#include "Partitioner.hpp"
+// required Corblivar headers
+#include "Block.hpp"
+#include "Net.hpp"
+#include "Math.hpp"
+
+// memory allocation
+constexpr int Partitioner::ANCHOR_LOW;
+constexpr int Partitioner::ANCHOR_HIGH;
+
+void Partitioner::partition(vector<Block> const& blocks, vector<Net> const& nets, int const& layers, bool const& log) {
+	vector<int> range_blocks, blocks_lo, blocks_hi;
+	vector<double> layers_area;
+	int TSVs;
+	unsigned b;
+
+	if (log) {
+		cout << "Corblivar> ";
+		cout << "Performing min-cut partitioning of blocks onto " << layers << " layers..." << endl;
+	}
+
+	// init all blocks to be assigned to the whole range of layers
+	for (b = 0; b < blocks.size(); b++) {
+		range_blocks.push_back(b);
+		blocks_lo.push_back(0);
+		blocks_hi.push_back(layers);
+	}
+
+	// recursive bisection
+	Partitioner::partitionRange(blocks, nets, range_blocks, 0, layers, blocks_lo, blocks_hi, true);
+
+	// memorize layer in blocks
+	layers_area.resize(layers, 0.0);
+	for (b = 0; b < blocks.size(); b++) {
+		blocks[b].layer = blocks_lo[b];
+		layers_area[blocks_lo[b]] += blocks[b].bb.area;
+	}
+
+	if (log) {
+
+		// determine TSVs, similar to FloorPlanner::evaluateInterconnects
+		TSVs = 0;
+		for (Net const& net : nets) {
+
+			if (net.blocks.empty()) {
+				continue;
+			}
+
+			net.setLayerBoundaries();
+
+			TSVs += net.layer_top - net.layer_bottom;
+			if (!net.terminals.empty()) {
+				TSVs += net.layer_bottom;
+			}
+		}
+
+		cout << "Corblivar> ";
+		cout << " TSVs (cut nets across layers): " << TSVs << endl;
+		for (int i = 0; i < layers; i++) {
+			cout << "Corblivar> ";
+			cout << " Layer " << i + 1 << "; blocks area: " << layers_area[i] << endl;
+		}
+		cout << "Corblivar> ";
+		cout << "Done" << endl << endl;
+	}
+}
+
+vector<int> Partitioner::cluster(vector<Block> const& blocks, vector<Net> const& nets, int const& layers, int const& clusters_per_layer) {
+	vector< vector<int> > layers_blocks;
+	vector<int> blocks_lo, blocks_hi;
+	unsigned b;
+
+	// init blocks to be assigned to the range of clusters of their layer
+	layers_blocks.resize(layers);
+	for (b = 0; b < blocks.size(); b++) {
+		layers_blocks[blocks[b].layer].push_back(b);
+		blocks_lo.push_back(blocks[b].layer * clusters_per_layer);
+		blocks_hi.push_back((blocks[b].layer + 1) * clusters_per_layer);
+	}
+
+	// recursive bisection for each layer separately; blocks in other layers
+	// are considered as anchors, similar to the assignment of blocks to layers.
+	// Terminal pins are not related to any particular cluster and are thus not
+	// considered as anchors
+	for (int i = 0; i < layers; i++) {
+		Partitioner::partitionRange(blocks, nets, layers_blocks[i], i * clusters_per_layer, (i + 1) * clusters_per_layer, blocks_lo, blocks_hi, false);
+	}
+
+	return blocks_lo;
+}
+
+void Partitioner::partitionRange(vector<Block> const& blocks, vector<Net> const& nets, vector<int> const& range_blocks,
+		int const& lo, int const& hi, vector<int>& blocks_lo, vector<int>& blocks_hi, bool const& terminals_anchored) {
+	Partitioner::Hypergraph hg;
+	vector<int> vertex, side, pins;
+	vector<int> range_blocks_lower, range_blocks_upper;
+	bool anchor_low, anchor_high;
+	int mid, id;
+	unsigned v, e;
+
+	// trivial case; only one layer in range
+	if (hi - lo <= 1) {
+
+		for (int const& b : range_blocks) {
+			blocks_lo[b] = lo;
+			blocks_hi[b] = lo + 1;
+		}
+
+		return;
+	}
+	// trivial case; no blocks
+	else if (range_blocks.empty()) {
+		return;
+	}
+
+	mid = (lo + hi) / 2;
+
+	// init hypergraph; first two vertices are the fixed anchors
+	hg.weight = {0.0, 0.0};
+	hg.fixed = {0, 1};
+
+	vertex.resize(blocks.size(), -1);
+	for (int const& b : range_blocks) {
+		vertex[b] = hg.size();
+		hg.weight.push_back(blocks[b].bb.area);
+		hg.fixed.push_back(-1);
+	}
+
+	// derive hyperedges from nets; consider blocks outside of the current range
+	// as anchors, i.e., blocks in lower layers and terminal pins (which require
+	// TSVs to the lowermost layer) as low anchor, and blocks in upper layers as
+	// high anchor
+	for (Net const& net : nets) {
+
+		pins.clear();
+		anchor_low = terminals_anchored && !net.terminals.empty();
+		anchor_high = false;
+
+		for (Block const* b : net.blocks) {
+
+			id = b->numerical_id;
+
+			if (vertex[id] != -1) {
+				pins.push_back(vertex[id]);
+			}
+			else if (blocks_hi[id] <= lo) {
+				anchor_low = true;
+			}
+			else if (blocks_lo[id] >= hi) {
+				anchor_high = true;
+			}
+		}
+
+		// net not relevant for current range
+		if (pins.empty()) {
+			continue;
+		}
+
+		if (anchor_low) {
+			pins.push_back(Partitioner::ANCHOR_LOW);
+		}
+		if (anchor_high) {
+			pins.push_back(Partitioner::ANCHOR_HIGH);
+		}
+
+		sort(pins.begin(), pins.end());
+		pins.erase(unique(pins.begin(), pins.end()), pins.end());
+
+		// nets w/ only one vertex cannot be cut
+		if (pins.size() < 2) {
+			continue;
+		}
+
+		hg.nets.push_back(pins);
+	}
+
+	hg.vertex_nets.resize(hg.size());
+	for (e = 0; e < hg.nets.size(); e++) {
+		for (int const& u : hg.nets[e]) {
+			hg.vertex_nets[u].push_back(e);
+		}
+	}
+
+	// bisection; the lower partition's area shall be according to its share of
+	// layers
+	side = Partitioner::bisect(hg, static_cast<double>(mid - lo) / (hi - lo));
+
+	for (int const& b : range_blocks) {
+
+		v = vertex[b];
+
+		if (side[v] == 0) {
+			range_blocks_lower.push_back(b);
+			blocks_lo[b] = lo;
+			blocks_hi[b] = mid;
+		}
+		else {
+			range_blocks_upper.push_back(b);
+			blocks_lo[b] = mid;
+			blocks_hi[b] = hi;
+		}
+	}
+
+	if (Partitioner::DBG) {
+		cout << "DBG_PARTITIONER> Bisection of layers [" << lo << ", " << hi << "); blocks lower part: " << range_blocks_lower.size();
+		cout << ", blocks upper part: " << range_blocks_upper.size() << ", cut: " << Partitioner::determCut(hg, side) << endl;
+	}
+
+	// recursive bisection of both parts
+	Partitioner::partitionRange(blocks, nets, range_blocks_lower, lo, mid, blocks_lo, blocks_hi, terminals_anchored);
+	Partitioner::partitionRange(blocks, nets, range_blocks_upper, mid, hi, blocks_lo, blocks_hi, terminals_anchored);
+}
+
+vector<int> Partitioner::bisect(Partitioner::Hypergraph const& hg, double const& target_ratio) {
+	vector<Partitioner::Hypergraph> levels;
+	vector< vector<int> > mappings;
+	vector<int> side, best_side, fine_side, order;
+	double total_weight, max_weight, target_weight, tolerance, weight0;
+	int i, cut, best_cut;
+	unsigned v, l;
+
+	total_weight = max_weight = 0.0;
+	for (double const& w : hg.weight) {
+		total_weight += w;
+		max_weight = max(max_weight, w);
+	}
+	target_weight = target_ratio * total_weight;
+	// tolerated imbalance, w.r.t. the smaller partition; at least the largest
+	// vertex must fit
+	tolerance = max(Partitioner::IMBALANCE * min(target_weight, total_weight - target_weight), max_weight);
+
+	/// coarsening
+	//
+	levels.push_back(hg);
+
+	while (levels.back().size() > Partitioner::COARSENING_LIMIT) {
+
+		Partitioner::Hypergraph coarse_hg;
+		vector<int> mapping;
+
+		if (!Partitioner::coarsen(levels.back(), tolerance, coarse_hg, mapping)) {
+			break;
+		}
+
+		levels.push_back(move(coarse_hg));
+		mappings.push_back(move(mapping));
+	}
+
+	/// initial partitioning of coarsest hypergraph; greedy filling of random
+	/// orders, refined by FM, the best result is kept
+	//
+	Partitioner::Hypergraph const& coarsest = levels.back();
+	best_cut = -1;
+
+	for (i = 0; i < Partitioner::INITIAL_PARTITIONS; i++) {
+
+		side.assign(coarsest.size(), 1);
+		order.clear();
+
+		for (v = 0; v < coarsest.size(); v++) {
+			if (coarsest.fixed[v] != -1) {
+				side[v] = coarsest.fixed[v];
+			}
+			else {
+				order.push_back(v);
+			}
+		}
+
+		// random order, Fisher-Yates shuffle
+		for (v = 1; v < order.size(); v++) {
+			swap(order[v], order[Math::randI(0, v + 1)]);
+		}
+
+		weight0 = 0.0;
+		for (int const& u : order) {
+			if (weight0 + coarsest.weight[u] <= target_weight) {
+				side[u] = 0;
+				weight0 += coarsest.weight[u];
+			}
+		}
+
+		cut = Partitioner::refineFM(coarsest, side, target_weight, tolerance);
+
+		if (best_cut == -1 || cut < best_cut) {
+			best_cut = cut;
+			best_side = side;
+		}
+	}
+
+	/// uncoarsening; project partition to finer levels and refine
+	//
+	side = move(best_side);
+
+	for (l = levels.size() - 1; l > 0; l--) {
+
+		fine_side.resize(levels[l - 1].size());
+		for (v = 0; v < fine_side.size(); v++) {
+			fine_side[v] = side[mappings[l - 1][v]];
+		}
+
+		Partitioner::refineFM(levels[l - 1], fine_side, target_weight, tolerance);
+
+		side = move(fine_side);
+	}
+
+	return side;
+}
+
+bool Partitioner::coarsen(Partitioner::Hypergraph const& hg, double const& max_weight, Partitioner::Hypergraph& coarse_hg, vector<int>& mapping) {
+	vector<int> order, touched, pins;
+	vector<double> rating;
+	int best, coarse_size;
+	unsigned v, e;
+
+	mapping.assign(hg.size(), -1);
+	rating.assign(hg.size(), 0.0);
+
+	// random visiting order, Fisher-Yates shuffle
+	for (v = 0; v < hg.size(); v++) {
+		order.push_back(v);
+	}
+	for (v = 1; v < order.size(); v++) {
+		swap(order[v], order[Math::randI(0, v + 1)]);
+	}
+
+	// heavy-edge matching; the rating of vertex pairs is the sum of 1 / (|e| - 1)
+	// for all nets e shared by the pair
+	coarse_size = 0;
+	for (int const& u : order) {
+
+		if (mapping[u] != -1) {
+			continue;
+		}
+
+		mapping[u] = coarse_size;
+
+		// fixed vertices are not to be matched
+		if (hg.fixed[u] != -1) {
+			coarse_size++;
+			continue;
+		}
+
+		touched.clear();
+		for (int const& n : hg.vertex_nets[u]) {
+			for (int const& w : hg.nets[n]) {
+
+				if (w == u || mapping[w] != -1 || hg.fixed[w] != -1 || hg.weight[u] + hg.weight[w] > max_weight) {
+					continue;
+				}
+
+				if (rating[w] == 0.0) {
+					touched.push_back(w);
+				}
+				rating[w] += 1.0 / (hg.nets[n].size() - 1);
+			}
+		}
+
+		best = -1;
+		for (int const& w : touched) {
+			if (best == -1 || rating[w] > rating[best]) {
+				best = w;
+			}
+			rating[w] = 0.0;
+		}
+
+		if (best != -1) {
+			mapping[best] = coarse_size;
+		}
+
+		coarse_size++;
+	}
+
+	// coarsening not effective anymore
+	if (coarse_size > Partitioner::COARSENING_MIN_REDUCTION * hg.size()) {
+		return false;
+	}
+
+	// build coarse hypergraph
+	coarse_hg.weight.assign(coarse_size, 0.0);
+	coarse_hg.fixed.assign(coarse_size, -1);
+
+	for (v = 0; v < hg.size(); v++) {
+		coarse_hg.weight[mapping[v]] += hg.weight[v];
+
+		if (hg.fixed[v] != -1) {
+			coarse_hg.fixed[mapping[v]] = hg.fixed[v];
+		}
+	}
+
+	for (e = 0; e < hg.nets.size(); e++) {
+
+		pins.clear();
+		for (int const& u : hg.nets[e]) {
+			pins.push_back(mapping[u]);
+		}
+
+		sort(pins.begin(), pins.end());
+		pins.erase(unique(pins.begin(), pins.end()), pins.end());
+
+		// nets covered by one coarse vertex are not relevant anymore
+		if (pins.size() < 2) {
+			continue;
+		}
+
+		coarse_hg.nets.push_back(pins);
+	}
+
+	coarse_hg.vertex_nets.resize(coarse_size);
+	for (e = 0; e < coarse_hg.nets.size(); e++) {
+		for (int const& u : coarse_hg.nets[e]) {
+			coarse_hg.vertex_nets[u].push_back(e);
+		}
+	}
+
+	return true;
+}
+
+int Partitioner::refineFM(Partitioner::Hypergraph const& hg, vector<int>& side, double const& target_weight, double const& tolerance) {
+	vector< array<int, 2> > pins_count;
+	vector<int> gain, moves;
+	vector<bool> locked;
+	array< set< pair<int, int> >, 2 > buckets;
+	array<int, 2> candidate;
+	double weight0, new_weight0;
+	int pass, cut, cur_cut, best_cut, from, to, u;
+	unsigned v, best_moves, i;
+	bool improved;
+
+	// helper to update gain of unlocked vertex; the buckets are ordered by
+	// decreasing gain
+	auto updateGain = [&](int const& w, int const& delta) {
+
+		if (locked[w]) {
+			return;
+		}
+
+		buckets[side[w]].erase({-gain[w], w});
+		gain[w] += delta;
+		buckets[side[w]].insert({-gain[w], w});
+	};
+
+	weight0 = 0.0;
+	for (v = 0; v < hg.size(); v++) {
+		if (side[v] == 0) {
+			weight0 += hg.weight[v];
+		}
+	}
+
+	cut = Partitioner::determCut(hg, side);
+
+	for (pass = 0; pass < Partitioner::FM_PASSES; pass++) {
+
+		// init pin counts, gains, and buckets
+		pins_count.assign(hg.nets.size(), {0, 0});
+		for (v = 0; v < hg.nets.size(); v++) {
+			for (int const& w : hg.nets[v]) {
+				pins_count[v][side[w]]++;
+			}
+		}
+
+		gain.assign(hg.size(), 0);
+		locked.assign(hg.size(), false);
+		buckets[0].clear();
+		buckets[1].clear();
+		moves.clear();
+
+		for (v = 0; v < hg.size(); v++) {
+
+			// fixed vertices are never moved
+			if (hg.fixed[v] != -1) {
+				locked[v] = true;
+				continue;
+			}
+
+			from = side[v];
+			to = 1 - from;
+
+			for (int const& n : hg.vertex_nets[v]) {
+				if (pins_count[n][from] == 1) {
+					gain[v]++;
+				}
+				if (pins_count[n][to] == 0) {
+					gain[v]--;
+				}
+			}
+
+			buckets[from].insert({-gain[v], v});
+		}
+
+		// balanced initial state is the reference; otherwise the first balanced
+		// state
+		cur_cut = cut;
+		if (abs(weight0 - target_weight) <= tolerance) {
+			best_cut = cut;
+		}
+		else {
+			best_cut = -1;
+		}
+		best_moves = 0;
+
+		// moves of vertices, until no balanced move is possible anymore
+		while (true) {
+
+			// determine best move from each side which retains balance
+			for (from = 0; from <= 1; from++) {
+
+				candidate[from] = -1;
+
+				for (pair<int, int> const& bucket_entry : buckets[from]) {
+
+					u = bucket_entry.second;
+
+					if (from == 0) {
+						new_weight0 = weight0 - hg.weight[u];
+					}
+					else {
+						new_weight0 = weight0 + hg.weight[u];
+					}
+
+					if (abs(new_weight0 - target_weight) <= tolerance) {
+						candidate[from] = u;
+						break;
+					}
+				}
+			}
+
+			if (candidate[0] == -1 && candidate[1] == -1) {
+				break;
+			}
+			else if (candidate[0] == -1) {
+				u = candidate[1];
+			}
+			else if (candidate[1] == -1) {
+				u = candidate[0];
+			}
+			else if (gain[candidate[0]] >= gain[candidate[1]]) {
+				u = candidate[0];
+			}
+			else {
+				u = candidate[1];
+			}
+
+			from = side[u];
+			to = 1 - from;
+
+			// lock and move vertex
+			buckets[from].erase({-gain[u], u});
+			locked[u] = true;
+			cur_cut -= gain[u];
+
+			// update gains of neighbours, according to the net's pin counts
+			// before and after the move
+			for (int const& n : hg.vertex_nets[u]) {
+
+				if (pins_count[n][to] == 0) {
+					for (int const& w : hg.nets[n]) {
+						updateGain(w, 1);
+					}
+				}
+				else if (pins_count[n][to] == 1) {
+					for (int const& w : hg.nets[n]) {
+						if (side[w] == to) {
+							updateGain(w, -1);
+						}
+					}
+				}
+
+				pins_count[n][from]--;
+				pins_count[n][to]++;
+
+				if (pins_count[n][from] == 0) {
+					for (int const& w : hg.nets[n]) {
+						updateGain(w, -1);
+					}
+				}
+				else if (pins_count[n][from] == 1) {
+					for (int const& w : hg.nets[n]) {
+						if (side[w] == from && w != u) {
+							updateGain(w, 1);
+						}
+					}
+				}
+			}
+
+			side[u] = to;
+			if (from == 0) {
+				weight0 -= hg.weight[u];
+			}
+			else {
+				weight0 += hg.weight[u];
+			}
+			moves.push_back(u);
+
+			// memorize best state
+			if (best_cut == -1 || cur_cut < best_cut) {
+				best_cut = cur_cut;
+				best_moves = moves.size();
+			}
+		}
+
+		// revert moves after best state
+		for (i = moves.size(); i > best_moves; i--) {
+
+			u = moves[i - 1];
+
+			if (side[u] == 0) {
+				weight0 -= hg.weight[u];
+			}
+			else {
+				weight0 += hg.weight[u];
+			}
+			side[u] = 1 - side[u];
+		}
+
+		// no balanced state found; stop refinement
+		if (best_cut == -1) {
+			break;
+		}
+
+		// memorize cut of best state; stop refinement if no improvement
+		improved = (best_cut < cut);
+		cut = best_cut;
+
+		if (!improved) {
+			break;
+		}
+	}
+
+	if (Partitioner::DBG) {
+		cout << "DBG_PARTITIONER> FM refinement; vertices: " << hg.size() << ", cut: " << cut << endl;
+	}
+
+	return cut;
+}
+
+int Partitioner::determCut(Partitioner::Hypergraph const& hg, vector<int> const& side) {
+	int cut;
+	bool side0, side1;
+
+	cut = 0;
+	for (vector<int> const& net : hg.nets) {
+
+		side0 = side1 = false;
+		for (int const& v : net) {
+			if (side[v] == 0) {
+				side0 = true;
+			}
+			else {
+				side1 = true;
+			}
+		}
+
+		if (side0 && side1) {
+			cut++;
+		}
+	}
+
+	return cut;
+}
@@ -0,0 +1,107 @@
+/*
+ * =====================================================================================
+ *
+ *    Description:  Corblivar min-cut partitioner, multi-level Fiduccia-Mattheyses
+ *
+ *    Copyright (C) 2013 Johann Knechtel, johann.knechtel@ifte.de, www.ifte.de
+ *
+ *    This file is part of Corblivar.
+ *    
+ *    Corblivar is free software: you can redistribute it and/or modify it under the terms
+ *    of the GNU General Public License as published by the Free Software Foundation,
+ *    either version 3 of the License, or (at your option) any later version.
+ *    
+ *    Corblivar is distributed in the hope that it will be useful, but WITHOUT ANY
+ *    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *    PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *    
+ *    You should have received a copy of the GNU General Public License along with
+ *    Corblivar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * =====================================================================================
+ */
+#ifndef _CORBLIVAR_PARTITIONER
+#define _CORBLIVAR_PARTITIONER
+
+// library includes
+#include "Corblivar.incl.hpp"
+// Corblivar includes, if any
+// forward declarations, if any
+class Block;
+class Net;
+
+class Partitioner {
+	// debugging code switch (private)
+	private:
+		static constexpr bool DBG = false;
+
+	// PODs, to be declared early on
+	private:
+		// hypergraph; vertices represent (clusters of) blocks, hyperedges
+		// represent nets. Vertices may be fixed to one side of the bisection;
+		// this is used for anchors of nets, i.e., for terminal pins and for
+		// blocks already assigned to other layers
+		struct Hypergraph {
+			vector<double> weight;
+			vector<int> fixed;
+			vector< vector<int> > nets;
+			vector< vector<int> > vertex_nets;
+
+			inline unsigned size() const {
+				return this->weight.size();
+			};
+		};
+
+	// private data, functions
+	private:
+		// coarsening is stopped for hypergraphs of this size
+		static constexpr unsigned COARSENING_LIMIT = 40;
+		// coarsening is also stopped if the number of vertices is not reduced
+		// by this factor anymore
+		static constexpr double COARSENING_MIN_REDUCTION = 0.9;
+		// tolerated imbalance of partitions' area, w.r.t. smaller partition
+		static constexpr double IMBALANCE = 0.05;
+		// initial partitions to be tried on coarsest hypergraph
+		static constexpr int INITIAL_PARTITIONS = 10;
+		// upper limit for FM passes per level
+		static constexpr int FM_PASSES = 10;
+
+		// vertex id for net anchors
+		static constexpr int ANCHOR_LOW = 0;
+		static constexpr int ANCHOR_HIGH = 1;
+
+		// recursive bisection of blocks, assigns blocks to partitions [lo, hi),
+		// i.e., to layers or clusters
+		static void partitionRange(vector<Block> const& blocks, vector<Net> const& nets, vector<int> const& range_blocks,
+				int const& lo, int const& hi, vector<int>& blocks_lo, vector<int>& blocks_hi, bool const& terminals_anchored);
+
+		// multi-level bisection; returns side for each vertex
+		static vector<int> bisect(Hypergraph const& hg, double const& target_ratio);
+		// coarsening by heavy-edge matching; returns the coarse hypergraph and
+		// the mapping of vertices to coarse vertices
+		static bool coarsen(Hypergraph const& hg, double const& max_weight, Hypergraph& coarse_hg, vector<int>& mapping);
+		// FM refinement; returns cut
+		static int refineFM(Hypergraph const& hg, vector<int>& side, double const& target_weight, double const& tolerance);
+		// cut, i.e., count of nets w/ vertices on both sides
+		static int determCut(Hypergraph const& hg, vector<int> const& side);
+
+	// constructors, destructors, if any non-implicit
+	// private in order to avoid instances of ``static'' class
+	private:
+		Partitioner() {
+		}
+
+	// public data, functions
+	public:
+		// assign blocks to layers such that the nets' cut, i.e., the TSV count,
+		// is minimized, while the blocks' area is balanced across layers
+		static void partition(vector<Block> const& blocks, vector<Net> const& nets, int const& layers, bool const& log);
+		// cluster blocks by connectivity, i.e., such that the nets' cut across
+		// clusters is minimized, while the clusters' area is balanced; blocks
+		// are clustered within their assigned layer. Returns the cluster for
+		// each block, where clusters [i * clusters_per_layer, (i + 1) *
+		// clusters_per_layer) relate to layer i
+		static vector<int> cluster(vector<Block> const& blocks, vector<Net> const& nets, int const& layers, int const& clusters_per_layer);
+};
+
+#endif
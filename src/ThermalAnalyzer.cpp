@@ -29,44 +29,147 @@
 #include "Block.hpp"
 #include "Math.hpp"
 #include "CorblivarAlignmentReq.hpp"
+#include "ThreadPool.hpp"
 
 // memory allocation
-constexpr int ThermalAnalyzer::POWER_MAPS_DIM;
+constexpr int ThermalAnalyzer::RESOLUTIONS_MAP_DIM[];
+constexpr int ThermalAnalyzer::RESOLUTIONS_MASK_DIM[];
 
-void ThermalAnalyzer::initPowerMaps(int const& layers, Point const& die_outline) {
-	unsigned b;
-	int i;
-	ThermalAnalyzer::PowerMapBin init_bin;
+// check whether the pair of thermal-map and thermal-mask dimensions is supported, i.e.,
+// whether a specialized power blurring is available
+bool ThermalAnalyzer::supportedResolution(int const& thermal_map_dim, int const& thermal_mask_dim) {
+
+	for (int r = 0; r < ThermalAnalyzer::RESOLUTIONS; r++) {
+		if (ThermalAnalyzer::RESOLUTIONS_MAP_DIM[r] == thermal_map_dim && ThermalAnalyzer::RESOLUTIONS_MASK_DIM[r] == thermal_mask_dim) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+// derive coarse resolution, i.e., the thermal-map dimension is reduced by the given
+// factor and the thermal-mask dimension is reduced accordingly, such that the mask covers
+// the same die region
+void ThermalAnalyzer::coarseResolution(int const& thermal_map_dim, int const& thermal_mask_dim, int const& factor, int& coarse_map_dim, int& coarse_mask_dim) {
+
+	coarse_map_dim = thermal_map_dim / factor;
+	// note that mask dimension has to be uneven; the mask shall cover at least the
+	// neighbouring bins
+	coarse_mask_dim = 2 * max(1, (thermal_mask_dim / 2) / factor) + 1;
+}
+
+// select the specialized power blurring for pair of thermal-map and thermal-mask
+// dimensions; returns nullptr for unsupported pairs
+template<typename T>
+ThermalAnalyzer::PowerBlurring ThermalAnalyzer::specializedPowerBlurring(int const& thermal_map_dim, int const& thermal_mask_dim) {
+
+	if (thermal_map_dim == 32 && thermal_mask_dim == 11) {
+		return &ThermalAnalyzer::performPowerBlurringSpecialized<32, 11, T>;
+	}
+	else if (thermal_map_dim == 64 && thermal_mask_dim == 11) {
+		return &ThermalAnalyzer::performPowerBlurringSpecialized<64, 11, T>;
+	}
+	else if (thermal_map_dim == 128 && thermal_mask_dim == 15) {
+		return &ThermalAnalyzer::performPowerBlurringSpecialized<128, 15, T>;
+	}
+	else if (thermal_map_dim == 128 && thermal_mask_dim == 21) {
+		return &ThermalAnalyzer::performPowerBlurringSpecialized<128, 21, T>;
+	}
+	// coarse resolutions, derived from the resolutions above, see
+	// coarseResolution(); only used for multi-resolution thermal analysis during
+	// SA
+	else if (thermal_map_dim == 8 && thermal_mask_dim == 3) {
+		return &ThermalAnalyzer::performPowerBlurringSpecialized<8, 3, T>;
+	}
+	else if (thermal_map_dim == 16 && thermal_mask_dim == 3) {
+		return &ThermalAnalyzer::performPowerBlurringSpecialized<16, 3, T>;
+	}
+	else if (thermal_map_dim == 16 && thermal_mask_dim == 5) {
+		return &ThermalAnalyzer::performPowerBlurringSpecialized<16, 5, T>;
+	}
+	else if (thermal_map_dim == 32 && thermal_mask_dim == 3) {
+		return &ThermalAnalyzer::performPowerBlurringSpecialized<32, 3, T>;
+	}
+	else if (thermal_map_dim == 32 && thermal_mask_dim == 5) {
+		return &ThermalAnalyzer::performPowerBlurringSpecialized<32, 5, T>;
+	}
+	else if (thermal_map_dim == 64 && thermal_mask_dim == 7) {
+		return &ThermalAnalyzer::performPowerBlurringSpecialized<64, 7, T>;
+	}
+	else {
+		return nullptr;
+	}
+}
+
+// init dimensions of thermal maps and masks, select the related specialized power
+// blurring; to be called before any other init handler. The convolution is performed
+// in single precision (float) if requested, otherwise in double precision
+void ThermalAnalyzer::initResolution(int const& thermal_map_dim, int const& thermal_mask_dim, bool const& single_precision) {
 
 	if (ThermalAnalyzer::DBG_CALLS) {
-		cout << "-> ThermalAnalyzer::initPowerMaps(" << layers << ", " << die_outline.x << ", " << die_outline.y << ")" << endl;
+		cout << "-> ThermalAnalyzer::initResolution(" << thermal_map_dim << ", " << thermal_mask_dim << ", " << single_precision << ")" << endl;
+	}
+
+	this->thermal_map_dim = thermal_map_dim;
+	this->thermal_mask_dim = thermal_mask_dim;
+	this->thermal_mask_center = this->thermal_mask_dim / 2;
+	this->power_maps_padded_bins = this->thermal_mask_center;
+	this->power_maps_dim = this->thermal_map_dim + (this->thermal_mask_dim - 1);
+
+	// select specialized power blurring; note that the resolution is expected to
+	// be checked beforehand
+	this->single_precision = single_precision;
+	if (this->single_precision) {
+		this->power_blurring = ThermalAnalyzer::specializedPowerBlurring<float>(thermal_map_dim, thermal_mask_dim);
+	}
+	else {
+		this->power_blurring = ThermalAnalyzer::specializedPowerBlurring<double>(thermal_map_dim, thermal_mask_dim);
 	}
 
-	this->power_maps.clear();
+	// (re)allocate thermal map
+	this->thermal_map.assign(this->thermal_map_dim, vector<double>(this->thermal_map_dim, 0.0));
 
-	// allocate power-maps arrays
-	for (i = 0; i < layers; i++) {
-		this->power_maps.emplace_back(
-			array<array<ThermalAnalyzer::PowerMapBin, ThermalAnalyzer::POWER_MAPS_DIM>, ThermalAnalyzer::POWER_MAPS_DIM>()
-		);
+	if (ThermalAnalyzer::DBG_CALLS) {
+		cout << "<- ThermalAnalyzer::initResolution" << endl;
 	}
+}
 
-	// init the maps w/ zero values
-	init_bin.power_density = init_bin.TSV_density = 0.0;
-	for (i = 0; i < layers; i++) {
-		for (auto& partial_map : this->power_maps[i]) {
-			partial_map.fill(init_bin);
-		}
+void ThermalAnalyzer::initPowerMaps(int const& layers, Point const& die_outline) {
+	int b;
+
+	if (ThermalAnalyzer::DBG_CALLS) {
+		cout << "-> ThermalAnalyzer::initPowerMaps(" << layers << ", " << die_outline.x << ", " << die_outline.y << ")" << endl;
+	}
+
+	// allocate power-maps planes, along w/ related difference arrays, and init
+	// them w/ zero values; note that the difference arrays are also expected to
+	// be zero-initialized, they are reset after each use
+	this->power_density_maps.assign(layers, vector<double>(this->power_maps_dim * this->power_maps_dim, 0.0));
+	this->TSV_density_maps.assign(layers, vector<double>(this->power_maps_dim * this->power_maps_dim, 0.0));
+	this->power_maps_deltas.assign(layers, vector<double>(this->power_maps_dim * this->power_maps_dim, 0.0));
+	// allocate single-precision planes only if required, see initResolution
+	if (this->single_precision) {
+		this->power_density_maps_float.assign(layers, vector<float>(this->power_maps_dim * this->power_maps_dim, 0.0f));
+	}
+	else {
+		this->power_density_maps_float.clear();
 	}
+	// allocate TSV-density levels and column flags; levels of the padding zone
+	// remain zero
+	this->TSV_density_levels.assign(layers, vector<unsigned char>(this->power_maps_dim * this->power_maps_dim, 0));
+	this->TSV_density_columns.assign(layers, vector<unsigned char>(this->power_maps_dim, 0));
+	this->TSV_density_levels_stack.assign(this->power_maps_dim * this->power_maps_dim, 0);
+	this->TSV_density_columns_stack.assign(this->power_maps_dim, 0);
 
 	// scale power map dimensions to outline of thermal map; this way the padding of
 	// power maps doesn't distort the block outlines in the thermal map
-	this->power_maps_dim_x = die_outline.x / ThermalAnalyzer::THERMAL_MAP_DIM;
-	this->power_maps_dim_y = die_outline.y / ThermalAnalyzer::THERMAL_MAP_DIM;
+	this->power_maps_dim_x = die_outline.x / this->thermal_map_dim;
+	this->power_maps_dim_y = die_outline.y / this->thermal_map_dim;
 
 	// determine offset for blocks, related to padding of power maps
-	this->blocks_offset_x = this->power_maps_dim_x * ThermalAnalyzer::POWER_MAPS_PADDED_BINS;
-	this->blocks_offset_y = this->power_maps_dim_y * ThermalAnalyzer::POWER_MAPS_PADDED_BINS;
+	this->blocks_offset_x = this->power_maps_dim_x * this->power_maps_padded_bins;
+	this->blocks_offset_y = this->power_maps_dim_y * this->power_maps_padded_bins;
 
 	// determine max distance for blocks' upper/right boundaries to upper/right die
 	// outline to be padded
@@ -76,10 +179,12 @@ void ThermalAnalyzer::initPowerMaps(int const& layers, Point const& die_outline)
 	// predetermine map bins' area and lower-left corner coordinates; note that the
 	// last bin represents the upper-right coordinates for the penultimate bin
 	this->power_maps_bin_area = this->power_maps_dim_x * this->power_maps_dim_y;
-	for (b = 0; b <= ThermalAnalyzer::POWER_MAPS_DIM; b++) {
+	this->power_maps_bins_ll_x.resize(this->power_maps_dim + 1);
+	this->power_maps_bins_ll_y.resize(this->power_maps_dim + 1);
+	for (b = 0; b <= this->power_maps_dim; b++) {
 		this->power_maps_bins_ll_x[b] = b * this->power_maps_dim_x;
 	}
-	for (b = 0; b <= ThermalAnalyzer::POWER_MAPS_DIM; b++) {
+	for (b = 0; b <= this->power_maps_dim; b++) {
 		this->power_maps_bins_ll_y[b] = b * this->power_maps_dim_y;
 	}
 
@@ -94,14 +199,17 @@ void ThermalAnalyzer::initPowerMaps(int const& layers, Point const& die_outline)
 // (uneven) array.
 // Note that masks are 1D, sufficient for the separated convolution in
 // performPowerBlurring()
-void ThermalAnalyzer::initThermalMasks(int const& layers, bool const& log, MaskParameters const& parameters) {
+void ThermalAnalyzer::initThermalMasks(int const& layers, bool const& log, MaskParameters const& parameters, bool const& TSV_density_masks) {
 	int i, ii;
 	double scale;
 	double layer_impulse_factor;
 	int x_y;
+	int level;
+	double TSV_density;
+	double TSV_impulse_scaling, TSV_spread_scaling;
 
 	if (ThermalAnalyzer::DBG_CALLS) {
-		cout << "-> ThermalAnalyzer::initThermalMasks(" << layers << ", " << log << ")" << endl;
+		cout << "-> ThermalAnalyzer::initThermalMasks(" << layers << ", " << log << ", " << &parameters << ", " << TSV_density_masks << ")" << endl;
 	}
 
 	if (log) {
@@ -115,7 +223,7 @@ void ThermalAnalyzer::initThermalMasks(int const& layers, bool const& log, MaskP
 	// allocate mask arrays
 	for (i = 0; i < layers; i++) {
 		this->thermal_masks.emplace_back(
-			array<double,ThermalAnalyzer::THERMAL_MASK_DIM>()
+			vector<double>(this->thermal_mask_dim)
 		);
 	}
 
@@ -131,7 +239,7 @@ void ThermalAnalyzer::initThermalMasks(int const& layers, bool const& log, MaskP
 	scale = sqrt(SPREAD * std::log(parameters.impulse_factor / (parameters.mask_boundary_value))) / sqrt(2.0);
 	// normalize factor according to half of mask dimension; i.e., fit spreading of
 	// exp function
-	scale /=  ThermalAnalyzer::THERMAL_MASK_CENTER;
+	scale /=  this->thermal_mask_center;
 
 	// determine all masks, starting from lowest layer, i.e., hottest layer
 	for (i = 1; i <= layers; i++) {
@@ -140,7 +248,7 @@ void ThermalAnalyzer::initThermalMasks(int const& layers, bool const& log, MaskP
 		layer_impulse_factor = parameters.impulse_factor / pow(i, parameters.impulse_factor_scaling_exponent);
 
 		ii = 0;
-		for (x_y = -ThermalAnalyzer::THERMAL_MASK_CENTER; x_y <= ThermalAnalyzer::THERMAL_MASK_CENTER; x_y++) {
+		for (x_y = -this->thermal_mask_center; x_y <= this->thermal_mask_center; x_y++) {
 			// sqrt for impulse factor is mandatory since the mask is
 			// used for separated convolution (i.e., factor will be
 			// squared in final convolution result)
@@ -150,13 +258,59 @@ void ThermalAnalyzer::initThermalMasks(int const& layers, bool const& log, MaskP
 		}
 	}
 
+	// determine TSV-density-aware masks, if required
+	this->TSV_density_masks = TSV_density_masks;
+	this->thermal_masks_TSV_density.clear();
+
+	if (this->TSV_density_masks) {
+
+		if (log) {
+			cout << "ThermalAnalyzer> ";
+			cout << "Initializing TSV-density-aware thermals masks for " << ThermalAnalyzer::TSV_DENSITY_LEVELS << " TSV-density levels ..." << endl;
+		}
+
+		this->thermal_masks_TSV_density.assign(layers,
+				vector< vector<double> >(ThermalAnalyzer::TSV_DENSITY_LEVELS, vector<double>(this->thermal_mask_dim))
+			);
+
+		for (level = 0; level < ThermalAnalyzer::TSV_DENSITY_LEVELS; level++) {
+
+			TSV_density = 100.0 * level / (ThermalAnalyzer::TSV_DENSITY_LEVELS - 1);
+
+			// the impulse is scaled down like the power densities of TSV
+			// regions, see adaptPowerMap; the impulse scaling relates to 1D
+			// masks, i.e., it is squared in the final 2D mask. The mask's
+			// spread is scaled according to the vertical thermal
+			// resistivity of the TSV-Si compound: the lateral spreading
+			// length of heat scales w/ the square root of the vertical
+			// resistance, i.e., the better the heat is conducted towards
+			// the heatsink, the less the heat spreads laterally
+			TSV_impulse_scaling = sqrt(max(0.0, 1.0 - (TSV_density / 100.0) * parameters.power_density_scaling_TSV_region));
+			TSV_spread_scaling = sqrt(ThermalAnalyzer::thermResSi(TSV_density) / ThermalAnalyzer::thermResSi());
+
+			for (i = 1; i <= layers; i++) {
+
+				layer_impulse_factor = parameters.impulse_factor / pow(i, parameters.impulse_factor_scaling_exponent);
+
+				ii = 0;
+				for (x_y = -this->thermal_mask_center; x_y <= this->thermal_mask_center; x_y++) {
+
+					this->thermal_masks_TSV_density[i - 1][level][ii] =
+						TSV_impulse_scaling * Math::gauss1D((x_y * scale) / TSV_spread_scaling, sqrt(layer_impulse_factor), SPREAD);
+
+					ii++;
+				}
+			}
+		}
+	}
+
 	if (ThermalAnalyzer::DBG) {
 		// enforce fixed digit count for printing mask
 		cout << fixed;
 		// dump mask
 		for (i = 0; i < layers; i++) {
 			cout << "DBG> Thermal 1D mask for point source on layer " << i << ":" << endl;
-			for (x_y = 0; x_y < ThermalAnalyzer::THERMAL_MASK_DIM; x_y++) {
+			for (x_y = 0; x_y < this->thermal_mask_dim; x_y++) {
 				cout << this->thermal_masks[i][x_y] << ", ";
 			}
 			cout << endl;
@@ -178,186 +332,286 @@ void ThermalAnalyzer::initThermalMasks(int const& layers, bool const& log, MaskP
 	}
 }
 
-void ThermalAnalyzer::generatePowerMaps(int const& layers, vector<Block> const& blocks, Point const& die_outline, MaskParameters const& parameters, bool const& extend_boundary_blocks_into_padding_zone) {
-	int i;
-	int x, y;
-	Rect bin, intersect, block_offset;
-	int x_lower, x_upper, y_lower, y_upper;
-	bool padding_zone;
-	ThermalAnalyzer::PowerMapBin init_bin;
+// process task(layer) for all layers; concurrently if a thread pool is given and the
+// stack is deep enough
+void ThermalAnalyzer::processLayers(int const& layers, ThreadPool* thread_pool, function<void(unsigned const&)> const& task) {
+
+	if (thread_pool != nullptr && layers >= ThermalAnalyzer::PARALLEL_MIN_LAYERS) {
+		thread_pool->run(layers, task);
+	}
+	else {
+		for (int layer = 0; layer < layers; layer++) {
+			task(layer);
+		}
+	}
+}
+
+// process task(x_begin, x_end) for ranges of columns covering [0, dim); one range per
+// thread if a thread pool is given and the stack is deep enough, otherwise one range
+// overall
+void ThermalAnalyzer::processColumns(int const& dim, int const& layers, ThreadPool* thread_pool, function<void(int const&, int const&)> const& task) {
+	unsigned ranges;
+
+	if (thread_pool != nullptr && layers >= ThermalAnalyzer::PARALLEL_MIN_LAYERS) {
+		ranges = min(thread_pool->threads(), static_cast<unsigned>(dim));
+	}
+	else {
+		ranges = 1;
+	}
+
+	if (ranges == 1) {
+		task(0, dim);
+	}
+	else {
+		thread_pool->run(ranges, [&](unsigned const& range) {
+			task((range * dim) / ranges, ((range + 1) * dim) / ranges);
+		});
+	}
+}
+
+void ThermalAnalyzer::generatePowerMaps(int const& layers, vector<Block> const& blocks, Point const& die_outline, MaskParameters const& parameters, bool const& extend_boundary_blocks_into_padding_zone,
+		ThreadPool* thread_pool) {
 
 	if (ThermalAnalyzer::DBG_CALLS) {
-		cout << "-> ThermalAnalyzer::generatePowerMaps(" << layers << ", " << &blocks << ", (" << die_outline.x << ", " << die_outline.y << "), " << &parameters << ", " << extend_boundary_blocks_into_padding_zone << ")" << endl;
+		cout << "-> ThermalAnalyzer::generatePowerMaps(" << layers << ", " << &blocks << ", (" << die_outline.x << ", " << die_outline.y << "), " << &parameters << ", " << extend_boundary_blocks_into_padding_zone << ", " << thread_pool << ")" << endl;
 	}
 
-	init_bin.power_density = 0.0;
-	init_bin.TSV_density = 0.0;
+	// the layers' maps are independent of each other
+	this->processLayers(layers, thread_pool, [&](unsigned const& layer) {
+		this->generatePowerMap(layer, blocks, die_outline, parameters, extend_boundary_blocks_into_padding_zone);
+	});
 
-	// determine maps for each layer
-	for (i = 0; i < layers; i++) {
+	if (ThermalAnalyzer::DBG_CALLS) {
+		cout << "<- ThermalAnalyzer::generatePowerMaps" << endl;
+	}
+}
+
+void ThermalAnalyzer::generatePowerMap(int const& layer, vector<Block> const& blocks, Point const& die_outline, MaskParameters const& parameters, bool const& extend_boundary_blocks_into_padding_zone) {
+	int x, y;
+	unsigned dx, dy;
+	Rect block_offset;
+	array<int, 4> bins_x, bins_y;
+	array<double, 4> deltas_x, deltas_y;
+	double column_sum;
+	// difference array and map of layer
+	vector<double>& deltas = this->power_maps_deltas[layer];
+	vector<double>& map = this->power_density_maps[layer];
+	// single-precision plane of layer, if required
+	float* map_float = this->single_precision ? this->power_density_maps_float[layer].data() : nullptr;
+
+	// rasterize all blocks of the layer in one pass, i.e., write their coverage
+	// deltas into the difference array; this way, the runtime is independent of
+	// the blocks' size
+	for (Block const& block : blocks) {
+
+		if (block.layer != layer) {
+			continue;
+		}
 
-		// reset map to zero
-		// note: this also implicitly pads the map w/ zero power density
-		for (auto& m : this->power_maps[i]) {
-			m.fill(init_bin);
+		// determine offset, i.e., shifted, block bb; relates to block's bb in
+		// padded power map
+		block_offset = block.bb;
+
+		// don't offset blocks at the left/lower chip boundaries, implicitly
+		// extend them into power-map padding zone; this way, during
+		// convolution, the thermal estimate increases for these blocks; blocks
+		// not at the boundaries are shifted
+		if (extend_boundary_blocks_into_padding_zone && block.bb.ll.x == 0.0) {
+		}
+		else {
+			block_offset.ll.x += this->blocks_offset_x;
+		}
+		if (extend_boundary_blocks_into_padding_zone && block.bb.ll.y == 0.0) {
+		}
+		else {
+			block_offset.ll.y += this->blocks_offset_y;
+		}
+
+		// also consider extending blocks into right/upper padding zone if they
+		// are close to the related chip boundaries
+		if (
+				extend_boundary_blocks_into_padding_zone &&
+				abs(die_outline.x - block.bb.ur.x) < this->padding_right_boundary_blocks_distance
+		   ) {
+			// consider offset twice in order to reach right/uppper boundary
+			// related to layout described by padded power map
+			block_offset.ur.x = die_outline.x + 2.0 * this->blocks_offset_x;
+		}
+		// simple shift otherwise; compensate for padding of left/bottom
+		// boundaries
+		else {
+			block_offset.ur.x += this->blocks_offset_x;
 		}
 
-		// consider each block on the related layer
-		for (Block const& block : blocks) {
+		if (
+				extend_boundary_blocks_into_padding_zone
+				&& abs(die_outline.y - block.bb.ur.y) < this->padding_upper_boundary_blocks_distance
+		   ) {
+			block_offset.ur.y = die_outline.y + 2.0 * this->blocks_offset_y;
+		}
+		else {
+			block_offset.ur.y += this->blocks_offset_y;
+		}
 
-			// drop blocks assigned to other layers
-			if (block.layer != i) {
+		// determine coverage deltas for offset block, given in bins; limit
+		// upper bounds to power-maps dimensions
+		ThermalAnalyzer::coverageDeltas(
+				block_offset.ll.x / this->power_maps_dim_x,
+				min(block_offset.ur.x / this->power_maps_dim_x, static_cast<double>(this->power_maps_dim)),
+				bins_x, deltas_x
+			);
+		ThermalAnalyzer::coverageDeltas(
+				block_offset.ll.y / this->power_maps_dim_y,
+				min(block_offset.ur.y / this->power_maps_dim_y, static_cast<double>(this->power_maps_dim)),
+				bins_y, deltas_y
+			);
+
+		// write corner deltas, weighted by block power density; deltas beyond
+		// the power-maps dimensions are irrelevant for the prefix sums
+		for (dx = 0; dx < bins_x.size(); dx++) {
+
+			if (bins_x[dx] >= this->power_maps_dim) {
 				continue;
 			}
 
-			// determine offset, i.e., shifted, block bb; relates to block's
-			// bb in padded power map
-			block_offset = block.bb;
+			for (dy = 0; dy < bins_y.size(); dy++) {
 
-			// don't offset blocks at the left/lower chip boundaries,
-			// implicitly extend them into power-map padding zone; this way,
-			// during convolution, the thermal estimate increases for these
-			// blocks; blocks not at the boundaries are shifted
-			if (extend_boundary_blocks_into_padding_zone && block.bb.ll.x == 0.0) {
-			}
-			else {
-				block_offset.ll.x += this->blocks_offset_x;
-			}
-			if (extend_boundary_blocks_into_padding_zone && block.bb.ll.y == 0.0) {
-			}
-			else {
-				block_offset.ll.y += this->blocks_offset_y;
+				if (bins_y[dy] >= this->power_maps_dim) {
+					continue;
+				}
+
+				deltas[this->bin(bins_x[dx], bins_y[dy])] += block.power_density * deltas_x[dx] * deltas_y[dy];
 			}
+		}
+	}
+
+	// determine map by one prefix-sum pass over the difference array
+	for (x = 0; x < this->power_maps_dim; x++) {
+
+		column_sum = 0.0;
+
+		for (y = 0; y < this->power_maps_dim; y++) {
 
-			// also consider extending blocks into right/upper padding zone if
-			// they are close to the related chip boundaries
-			if (
-					extend_boundary_blocks_into_padding_zone &&
-					abs(die_outline.x - block.bb.ur.x) < this->padding_right_boundary_blocks_distance
-			   ) {
-				// consider offset twice in order to reach right/uppper
-				// boundary related to layout described by padded power map
-				block_offset.ur.x = die_outline.x + 2.0 * this->blocks_offset_x;
+			// prefix sum along y for the current column, then along x
+			// using the previous, already summed up column
+			column_sum += deltas[this->bin(x, y)];
+			map[this->bin(x, y)] = column_sum;
+			if (x > 0) {
+				map[this->bin(x, y)] += map[this->bin(x - 1, y)];
 			}
-			// simple shift otherwise; compensate for padding of left/bottom
-			// boundaries
-			else {
-				block_offset.ur.x += this->blocks_offset_x;
+			if (map_float != nullptr) {
+				map_float[this->bin(x, y)] = map[this->bin(x, y)];
 			}
 
-			if (
-					extend_boundary_blocks_into_padding_zone
-					&& abs(die_outline.y - block.bb.ur.y) < this->padding_upper_boundary_blocks_distance
-			   ) {
-				block_offset.ur.y = die_outline.y + 2.0 * this->blocks_offset_y;
+			// reset difference array for next run
+			deltas[this->bin(x, y)] = 0.0;
+		}
+	}
+
+	// also reset the TSV densities, along w/ the flags for TSV-density levels
+	fill(this->TSV_density_maps[layer].begin(), this->TSV_density_maps[layer].end(), 0.0);
+	fill(this->TSV_density_columns[layer].begin(), this->TSV_density_columns[layer].end(), 0);
+	if (layer == 0) {
+		fill(this->TSV_density_columns_stack.begin(), this->TSV_density_columns_stack.end(), 0);
+	}
+
+	// scale power densities of bins w/in padding zone; only after the
+	// prefix sums are determined for the whole map
+	for (x = 0; x < this->power_maps_dim; x++) {
+
+		// inner bins: only the bins at the lower and upper boundary
+		// are w/in the padding zone
+		if (this->power_maps_padded_bins <= x && x < (this->power_maps_dim - this->power_maps_padded_bins)) {
+
+			for (y = 0; y < this->power_maps_padded_bins; y++) {
+				this->scalePowerDensity(map, map_float, x, y, parameters.power_density_scaling_padding_zone);
 			}
-			else {
-				block_offset.ur.y += this->blocks_offset_y;
+			for (y = this->power_maps_dim - this->power_maps_padded_bins; y < this->power_maps_dim; y++) {
+				this->scalePowerDensity(map, map_float, x, y, parameters.power_density_scaling_padding_zone);
+			}
+		}
+		// left and right boundary: all bins are w/in the padding zone
+		else {
+			for (y = 0; y < this->power_maps_dim; y++) {
+				this->scalePowerDensity(map, map_float, x, y, parameters.power_density_scaling_padding_zone);
 			}
+		}
+	}
+}
 
-			// determine index boundaries for offset block; based on boundary
-			// of blocks and the covered bins; note that cast to int truncates
-			// toward zero, i.e., performs like floor for positive numbers
-			x_lower = static_cast<int>(block_offset.ll.x / this->power_maps_dim_x);
-			y_lower = static_cast<int>(block_offset.ll.y / this->power_maps_dim_y);
-			// +1 in order to efficiently emulate the result of ceil(); limit
-			// upper bound to power-maps dimenions
-			x_upper = min(static_cast<int>(block_offset.ur.x / this->power_maps_dim_x) + 1, ThermalAnalyzer::POWER_MAPS_DIM);
-			y_upper = min(static_cast<int>(block_offset.ur.y / this->power_maps_dim_y) + 1, ThermalAnalyzer::POWER_MAPS_DIM);
-
-			// walk power-map bins covering block outline
-			for (x = x_lower; x < x_upper; x++) {
-				for (y = y_lower; y < y_upper; y++) {
-
-					// determine if bin w/in padding zone
-					if (
-							x < ThermalAnalyzer::POWER_MAPS_PADDED_BINS
-							|| x >= (ThermalAnalyzer::POWER_MAPS_DIM - ThermalAnalyzer::POWER_MAPS_PADDED_BINS)
-							|| y < ThermalAnalyzer::POWER_MAPS_PADDED_BINS
-							|| y >= (ThermalAnalyzer::POWER_MAPS_DIM - ThermalAnalyzer::POWER_MAPS_PADDED_BINS)
-					   ) {
-						padding_zone = true;
-					}
-					else {
-						padding_zone = false;
-					}
+void ThermalAnalyzer::adaptPowerMaps(int const& layers, vector<TSV_Group> const& TSVs, vector<Net> const& nets, MaskParameters const& parameters,
+		ThreadPool* thread_pool) {
 
-					// consider full block power density for fully covered bins
-					if (x_lower < x && x < (x_upper - 1) && y_lower < y && y < (y_upper - 1)) {
-						if (padding_zone) {
-							this->power_maps[i][x][y].power_density += block.power_density * parameters.power_density_scaling_padding_zone;
-						}
-						else {
-							this->power_maps[i][x][y].power_density += block.power_density;
-						}
-					}
-					// else consider block power according to
-					// intersection of current bin and block
-					else {
-						// determine real coords of map bin
-						bin.ll.x = this->power_maps_bins_ll_x[x];
-						bin.ll.y = this->power_maps_bins_ll_y[y];
-						// note that +1 is guaranteed to be within bounds
-						// of power_maps_bins_ll_x/y (size =
-						// ThermalAnalyzer::POWER_MAPS_DIM + 1); the
-						// related last tuple describes the upper-right
-						// corner coordinates of the right/top boundary
-						bin.ur.x = this->power_maps_bins_ll_x[x + 1];
-						bin.ur.y = this->power_maps_bins_ll_y[y + 1];
-
-						// determine intersection
-						intersect = Rect::determineIntersection(bin, block_offset);
-						// normalize to full bin area
-						intersect.area /= this->power_maps_bin_area;
-
-						if (padding_zone) {
-							this->power_maps[i][x][y].power_density += block.power_density * intersect.area * parameters.power_density_scaling_padding_zone;
-						}
-						else {
-							this->power_maps[i][x][y].power_density += block.power_density * intersect.area;
-						}
-					}
+	if (ThermalAnalyzer::DBG_CALLS) {
+		cout << "-> ThermalAnalyzer::adaptPowerMaps(" << layers << ", " << &TSVs << ", " << &nets << ", " << &parameters << ", " << thread_pool << ")" << endl;
+	}
+
+	// the layers' maps are independent of each other
+	this->processLayers(layers, thread_pool, [&](unsigned const& layer) {
+		this->adaptPowerMap(layer, TSVs, nets, parameters);
+	});
+
+	// TSV-density-aware masks: also determine levels for TSV densities averaged
+	// across all layers, see performPowerBlurringSpecialized
+	if (this->TSV_density_masks) {
+
+		for (int x = this->power_maps_padded_bins; x < this->thermal_map_dim + this->power_maps_padded_bins; x++) {
+
+			this->TSV_density_columns_stack[x] = 0;
+
+			for (int y = this->power_maps_padded_bins; y < this->thermal_map_dim + this->power_maps_padded_bins; y++) {
+
+				double TSV_density = 0.0;
+				for (int layer = 0; layer < layers; layer++) {
+					TSV_density += this->TSV_density_maps[layer][this->bin(x, y)];
 				}
+
+				this->TSV_density_levels_stack[this->bin(x, y)] = ThermalAnalyzer::TSVDensityLevel(TSV_density / layers);
+				this->TSV_density_columns_stack[x] |= this->TSV_density_levels_stack[this->bin(x, y)];
 			}
 		}
 	}
 
 	if (ThermalAnalyzer::DBG_CALLS) {
-		cout << "<- ThermalAnalyzer::generatePowerMaps" << endl;
+		cout << "<- ThermalAnalyzer::adaptPowerMaps" << endl;
 	}
 }
 
-void ThermalAnalyzer::adaptPowerMaps(int const& layers, vector<TSV_Group> const& TSVs, vector<Net> const& nets, MaskParameters const& parameters) {
+void ThermalAnalyzer::adaptPowerMap(int const& layer, vector<TSV_Group> const& TSVs, vector<Net> const& nets, MaskParameters const& parameters) {
 	int x, y;
-	Rect aligned_blocks_intersect;
 	Rect bin, bin_intersect;
 	int x_lower, x_upper, y_lower, y_upper;
 	int i;
-	Rect bb, prev_bb;
-
-	if (ThermalAnalyzer::DBG_CALLS) {
-		cout << "-> ThermalAnalyzer::adaptPowerMaps(" << layers << ", " << &TSVs << ", " << &nets << ", " << &parameters << ")" << endl;
-	}
+	Rect bb;
+	// maps of layer
+	vector<double>& TSV_density_map = this->TSV_density_maps[layer];
+	vector<double>& power_density_map = this->power_density_maps[layer];
+	float* power_density_map_float = this->single_precision ? this->power_density_maps_float[layer].data() : nullptr;
 
 	// consider impact of vertical buses; map TSVs to power maps
 	for (TSV_Group const& TSV_group : TSVs) {
 
+		if (TSV_group.layer != layer) {
+			continue;
+		}
+
 		// offset intersection, i.e., account for padded power maps and related
 		// offset in coordinates
-		TSV_group.bb.ll.x += this->blocks_offset_x;
-		TSV_group.bb.ll.y += this->blocks_offset_y;
-		TSV_group.bb.ur.x += this->blocks_offset_x;
-		TSV_group.bb.ur.y += this->blocks_offset_y;
+		bb = TSV_group.bb;
+		bb.ll.x += this->blocks_offset_x;
+		bb.ll.y += this->blocks_offset_y;
+		bb.ur.x += this->blocks_offset_x;
+		bb.ur.y += this->blocks_offset_y;
 
 		// determine index boundaries for offset intersection; based on boundary
 		// of intersection and the covered bins; note that cast to int truncates
 		// toward zero, i.e., performs like floor for positive numbers
-		x_lower = static_cast<int>(TSV_group.bb.ll.x / this->power_maps_dim_x);
-		y_lower = static_cast<int>(TSV_group.bb.ll.y / this->power_maps_dim_y);
+		x_lower = static_cast<int>(bb.ll.x / this->power_maps_dim_x);
+		y_lower = static_cast<int>(bb.ll.y / this->power_maps_dim_y);
 		// +1 in order to efficiently emulate the result of ceil(); limit upper
 		// bound to power-maps dimensions
-		x_upper = min(static_cast<int>(TSV_group.bb.ur.x / this->power_maps_dim_x) + 1, ThermalAnalyzer::POWER_MAPS_DIM);
-		y_upper = min(static_cast<int>(TSV_group.bb.ur.y / this->power_maps_dim_y) + 1, ThermalAnalyzer::POWER_MAPS_DIM);
+		x_upper = min(static_cast<int>(bb.ur.x / this->power_maps_dim_x) + 1, this->power_maps_dim);
+		y_upper = min(static_cast<int>(bb.ur.y / this->power_maps_dim_y) + 1, this->power_maps_dim);
 
 		if (ThermalAnalyzer::DBG) {
 			cout << "DBG> TSV group " << TSV_group.id << endl;
@@ -374,7 +628,7 @@ void ThermalAnalyzer::adaptPowerMaps(int const& layers, vector<TSV_Group> const&
 				if (x_lower < x && x < (x_upper - 1) && y_lower < y && y < (y_upper - 1)) {
 
 					// adapt map on affected layer
-					this->power_maps[TSV_group.layer][x][y].TSV_density += 100.0;
+					TSV_density_map[this->bin(x, y)] += 100.0;
 				}
 				// else consider TSV density according to partial
 				// intersection with current bin
@@ -384,7 +638,7 @@ void ThermalAnalyzer::adaptPowerMaps(int const& layers, vector<TSV_Group> const&
 					bin.ll.y = this->power_maps_bins_ll_y[y];
 					// note that +1 is guaranteed to be within
 					// bounds of power_maps_bins_ll_x/y (size
-					// = ThermalAnalyzer::POWER_MAPS_DIM + 1);
+					// = this->power_maps_dim + 1);
 					// the related last tuple describes the
 					// upper-right corner coordinates of the
 					// right/top boundary
@@ -392,12 +646,12 @@ void ThermalAnalyzer::adaptPowerMaps(int const& layers, vector<TSV_Group> const&
 					bin.ur.y = this->power_maps_bins_ll_y[y + 1];
 
 					// determine intersection
-					bin_intersect = Rect::determineIntersection(bin, TSV_group.bb);
+					bin_intersect = Rect::determineIntersection(bin, bb);
 					// normalize to full bin area
 					bin_intersect.area /= this->power_maps_bin_area;
 
 					// adapt map on affected layer
-					this->power_maps[TSV_group.layer][x][y].TSV_density += 100.0 * bin_intersect.area;
+					TSV_density_map[this->bin(x, y)] += 100.0 * bin_intersect.area;
 				}
 			}
 		}
@@ -412,112 +666,107 @@ void ThermalAnalyzer::adaptPowerMaps(int const& layers, vector<TSV_Group> const&
 	// determine TSV impact for each net
 	for (Net const& cur_net : nets) {
 
+		// ignore net's uppermost layer and any layer above since no TSV
+		// connects further up from this last layer
+		if (layer >= cur_net.layer_top) {
+			continue;
+		}
+
 		if (ThermalAnalyzer::DBG) {
 			cout << "DBG> Determining impact of net " << cur_net.id << endl;
 		}
 
-		// set layer boundaries, i.e., determine lowest and uppermost layer of
-		// net's blocks
-		cur_net.setLayerBoundaries();
+		// determine TSV's bounding box on the layer; in case the bb on the
+		// layer is zero, reuse the bb from the layers below (this arises from
+		// Net::updateBoundingBoxes being coded for HPWL calculation, where a
+		// layer in between with no blocks should not increase HPWL, but is
+		// required to account for TSV placement)
+		for (i = layer; i >= 0; i--) {
 
-		// determine TSV's bounding box on each related layer separately; ignore
-		// net's uppermost layer since no TSV connects further up from this last
-		// layer
-		for (i = 0; i < cur_net.layer_top; i++) {
+			bb = cur_net.boundingBox(i);
 
-			prev_bb = bb;
-			bb = cur_net.determBoundingBox(i);
-
-			// in case the bb on the current layer is zero, reuse the bb from
-			// the layer below (this arises from Net::determBoundingBox being
-			// coded for HPWL calculation, where a layer in between with no
-			// blocks should not increase HPWL, but is required to account for
-			// TSV placement)
-			if (bb.area == 0.0) {
-				bb = prev_bb;
-			}
-			// if the bb is still zero, then the first block of the net is
-			// placed in some upper layer
-			if (bb.area == 0.0) {
-				continue;
+			if (bb.area != 0.0) {
+				break;
 			}
+		}
+		// if the bb is still zero, then the first block of the net is placed in
+		// some upper layer
+		if (bb.area == 0.0) {
+			continue;
+		}
 
-			if (ThermalAnalyzer::DBG) {
-				cout << "DBG>  TSV assumed in layer " << i << endl;
-				cout << "DBG>   bb: " << bb.ll.x << "," << bb.ll.y << " to " << bb.ur.x << "," << bb.ur.y << endl;
-				cout << "DBG>   bb area: " << bb.area << endl;
-			}
+		if (ThermalAnalyzer::DBG) {
+			cout << "DBG>  TSV assumed in layer " << layer << endl;
+			cout << "DBG>   bb: " << bb.ll.x << "," << bb.ll.y << " to " << bb.ur.x << "," << bb.ur.y << endl;
+			cout << "DBG>   bb area: " << bb.area << endl;
+		}
 
-			// offset bb, i.e., account for padded power maps and related
-			// offset in coordinates
-			bb.ll.x += this->blocks_offset_x;
-			bb.ll.y += this->blocks_offset_y;
-			bb.ur.x += this->blocks_offset_x;
-			bb.ur.y += this->blocks_offset_y;
-
-			// determine index boundaries for offset bb; based on boundary of
-			// intersection and the covered bins; note that cast to int
-			// truncates toward zero, i.e., performs like floor for positive
-			// numbers
-			x_lower = static_cast<int>(bb.ll.x / this->power_maps_dim_x);
-			y_lower = static_cast<int>(bb.ll.y / this->power_maps_dim_y);
-			// +1 in order to efficiently emulate the result of ceil(); limit
-			// upper bound to power-maps dimensions
-			x_upper = min(static_cast<int>(bb.ur.x / this->power_maps_dim_x) + 1, ThermalAnalyzer::POWER_MAPS_DIM);
-			y_upper = min(static_cast<int>(bb.ur.y / this->power_maps_dim_y) + 1, ThermalAnalyzer::POWER_MAPS_DIM);
-
-			// walk power-map bins covering bb outline; adapt TSV densities;
-			// don't care about particular amount of coverage b/w bb and map
-			// bins, since the density of a single TSV is quite small
-			// only consider fully covered bins
-			for (x = x_lower; x < x_upper; x++) {
-				for (y = y_lower; y < y_upper; y++) {
-
-					// spread out the impact of this TSV across its
-					// bb; consider TSV pitch since 100% TSV density
-					// equals to closely packed TSVs, i.e., only w/
-					// pitch distance between each other; scale TSV
-					// pitch up (from um) since bb area is implicitly
-					// coded in um
-					this->power_maps[i][x][y].TSV_density += 100.0 * (pow(Chip::TSV_PITCH * 1.0e6, 2) / bb.area);
-				}
-			}
+		// offset bb, i.e., account for padded power maps and related offset in
+		// coordinates
+		bb.ll.x += this->blocks_offset_x;
+		bb.ll.y += this->blocks_offset_y;
+		bb.ur.x += this->blocks_offset_x;
+		bb.ur.y += this->blocks_offset_y;
+
+		// determine index boundaries for offset bb; based on boundary of
+		// intersection and the covered bins; note that cast to int truncates
+		// toward zero, i.e., performs like floor for positive numbers
+		x_lower = static_cast<int>(bb.ll.x / this->power_maps_dim_x);
+		y_lower = static_cast<int>(bb.ll.y / this->power_maps_dim_y);
+		// +1 in order to efficiently emulate the result of ceil(); limit upper
+		// bound to power-maps dimensions
+		x_upper = min(static_cast<int>(bb.ur.x / this->power_maps_dim_x) + 1, this->power_maps_dim);
+		y_upper = min(static_cast<int>(bb.ur.y / this->power_maps_dim_y) + 1, this->power_maps_dim);
 
-			if (ThermalAnalyzer::DBG) {
-				cout << "DBG>   additional TSV density for each bin: " <<
-					100.0 * (pow(Chip::TSV_PITCH * 1.0e6, 2) / bb.area) << endl;
-				cout << "DBG>   affected power-map bins: " << x_lower << "," << y_lower
-					<< " to " <<
-					x_upper << "," << y_upper << endl;
+		// walk power-map bins covering bb outline; adapt TSV densities; don't
+		// care about particular amount of coverage b/w bb and map bins, since
+		// the density of a single TSV is quite small only consider fully
+		// covered bins
+		for (x = x_lower; x < x_upper; x++) {
+			for (y = y_lower; y < y_upper; y++) {
+
+				// spread out the impact of this TSV across its bb; consider
+				// TSV pitch since 100% TSV density equals to closely packed
+				// TSVs, i.e., only w/ pitch distance between each other;
+				// scale TSV pitch up (from um) since bb area is implicitly
+				// coded in um
+				TSV_density_map[this->bin(x, y)] += 100.0 * (pow(Chip::TSV_PITCH * 1.0e6, 2) / bb.area);
 			}
 		}
+
+		if (ThermalAnalyzer::DBG) {
+			cout << "DBG>   additional TSV density for each bin: " <<
+				100.0 * (pow(Chip::TSV_PITCH * 1.0e6, 2) / bb.area) << endl;
+			cout << "DBG>   affected power-map bins: " << x_lower << "," << y_lower
+				<< " to " <<
+				x_upper << "," << y_upper << endl;
+		}
 	}
 
 	// walk power-map bins; adapt power according to TSV densities
-	for (x = ThermalAnalyzer::POWER_MAPS_PADDED_BINS; x < ThermalAnalyzer::THERMAL_MAP_DIM + ThermalAnalyzer::POWER_MAPS_PADDED_BINS; x++) {
-		for (y = ThermalAnalyzer::POWER_MAPS_PADDED_BINS; y < ThermalAnalyzer::THERMAL_MAP_DIM + ThermalAnalyzer::POWER_MAPS_PADDED_BINS; y++) {
+	for (x = this->power_maps_padded_bins; x < this->thermal_map_dim + this->power_maps_padded_bins; x++) {
+		for (y = this->power_maps_padded_bins; y < this->thermal_map_dim + this->power_maps_padded_bins; y++) {
 
 			// sanity check; TSV density should be <= 100%; might be larger
 			// due to superposition in calculations above
-			for (i = 0; i < layers; i++) {
-				this->power_maps[i][x][y].TSV_density = min(100.0, this->power_maps[i][x][y].TSV_density);
-			}
+			TSV_density_map[this->bin(x, y)] = min(100.0, TSV_density_map[this->bin(x, y)]);
 
-			// adapt maps for all but the uppermost layer; the uppermost layer
-			// next the heatsink shouldn't contain TSVs
-			for (i = 0; i < layers; i++) {
+			// for TSV-density-aware masks, the TSV impact is considered
+			// during power blurring; memorize the level of the TSV density
+			// for selecting the masks
+			if (this->TSV_density_masks) {
 
-				// scaling depends on TSV density; the larger the TSV
-				// density, the larger the power down-scaling
-				this->power_maps[i][x][y].power_density *= 1.0 -
-					((this->power_maps[i][x][y].TSV_density / 100.0) * parameters.power_density_scaling_TSV_region);
+				this->TSV_density_levels[layer][this->bin(x, y)] = ThermalAnalyzer::TSVDensityLevel(TSV_density_map[this->bin(x, y)]);
+				this->TSV_density_columns[layer][x] |= this->TSV_density_levels[layer][this->bin(x, y)];
+			}
+			// otherwise, scaling depends on TSV density; the larger the TSV
+			// density, the larger the power down-scaling
+			else {
+				this->scalePowerDensity(power_density_map, power_density_map_float, x, y, 1.0 -
+					((TSV_density_map[this->bin(x, y)] / 100.0) * parameters.power_density_scaling_TSV_region));
 			}
 		}
 	}
-
-	if (ThermalAnalyzer::DBG_CALLS) {
-		cout << "<- ThermalAnalyzer::adaptPowerMaps" << endl;
-	}
 }
 
 // Thermal-analyzer routine based on power blurring,
@@ -525,57 +774,110 @@ void ThermalAnalyzer::adaptPowerMaps(int const& layers, vector<TSV_Group> const&
 // Based on a separated convolution using separated 2D gauss function, i.e., 1D gauss fct.
 // Returns cost (max * avg temp estimate) of thermal map of lowest layer, i.e., hottest layer
 // Based on http://www.songho.ca/dsp/convolution/convolution.html#separable_convolution
-void ThermalAnalyzer::performPowerBlurring(Temp& ret, int const& layers, MaskParameters const& parameters) {
+void ThermalAnalyzer::performPowerBlurring(Temp& ret, int const& layers, MaskParameters const& parameters, ThreadPool* thread_pool) {
+
+	if (ThermalAnalyzer::DBG_CALLS) {
+		cout << "-> ThermalAnalyzer::performPowerBlurring(" << &ret << ", " << ", " << layers << ", " << &parameters << ", " << thread_pool << ")" << endl;
+	}
+
+	// perform power blurring specialized for the selected resolution
+	(this->*power_blurring)(ret, layers, parameters, thread_pool);
+
+	if (ThermalAnalyzer::DBG_CALLS) {
+		cout << "<- ThermalAnalyzer::performPowerBlurring" << endl;
+	}
+}
+
+// power blurring, specialized for thermal-map and thermal-mask dimensions; this way, all
+// loops have compile-time trip counts and the convolution loops over the masks can be
+// fully unrolled. The convolution is performed in floating-point type T; the innermost
+// loops walk contiguous columns of the power-map planes, i.e., they can be vectorized.
+// Both convolution passes are independent for different columns, i.e., ranges of
+// columns are processed in parallel if requested
+template<int MAP_DIM, int MASK_DIM, typename T>
+void ThermalAnalyzer::performPowerBlurringSpecialized(Temp& ret, int const& layers, MaskParameters const& parameters, ThreadPool* thread_pool) {
+	// dimensions, see related members
+	static constexpr int MASK_CENTER = MASK_DIM / 2;
+	static constexpr int PADDED_BINS = MASK_CENTER;
+	static constexpr int MAPS_DIM = MAP_DIM + (MASK_DIM - 1);
+
 	int layer;
-	int x, y, i;
-	int map_x, map_y;
+	int x, y;
 	int mask_i;
 	double max_temp, avg_temp;
+	// local copies of all masks
+	vector< array<T, MASK_DIM> > masks(layers);
+	// sum of masks of all layers, see vertical convolution
+	array<T, MASK_DIM> mask_sum;
+	// TSV-density-aware masks, if activated; local copies, ordered such that the
+	// masks' values for all levels are contiguous for each mask element, i.e.,
+	// masks_TSV_density[layer][mask_i][level]; also summed for all layers
+	vector< array< array<T, TSV_DENSITY_LEVELS>, MASK_DIM > > masks_TSV_density;
+	array< array<T, TSV_DENSITY_LEVELS>, MASK_DIM > mask_sum_TSV_density;
+	int level;
+	// power-map planes of all layers
+	vector<T const*> power_maps(layers);
 	// required as buffer for separated convolution; note that its dimensions
 	// corresponds to a power map, which is required to hold temporary results for 1D
 	// convolution of padded power maps
-	array<array<double,ThermalAnalyzer::POWER_MAPS_DIM>,ThermalAnalyzer::POWER_MAPS_DIM> thermal_map_tmp;
+	array<array<T, MAPS_DIM>, MAPS_DIM> thermal_map_tmp;
 
-	if (ThermalAnalyzer::DBG_CALLS) {
-		cout << "-> ThermalAnalyzer::performPowerBlurring(" << &ret << ", " << ", " << layers << ", " << &parameters << ")" << endl;
-	}
+	mask_sum.fill(0.0);
+	for (layer = 0; layer < layers; layer++) {
 
-	// init temp map w/ zero
-	for (auto& m : thermal_map_tmp) {
-		m.fill(0.0);
+		for (mask_i = 0; mask_i < MASK_DIM; mask_i++) {
+			masks[layer][mask_i] = this->thermal_masks[layer][mask_i];
+			mask_sum[mask_i] += masks[layer][mask_i];
+		}
+		power_maps[layer] = this->powerDensityPlane(layer, static_cast<T*>(nullptr));
 	}
 
-	// Init final map w/ temperature offset; temperature offset is expected to be
-	// equal for all cases, i.e., independent of TSV density / assuming zero TSVs;
-	// this is required for resonable values w/o gaps at boundary bins w/ different
-	// thermal masks. Note that temperature offset is a additive factor, and thus not
-	// considered during convolution.
-	for (auto& m : this->thermal_map) {
-		m.fill(parameters.temp_offset);
+	if (this->TSV_density_masks) {
+
+		masks_TSV_density.resize(layers);
+		for (auto& m : mask_sum_TSV_density) {
+			m.fill(0.0);
+		}
+
+		for (layer = 0; layer < layers; layer++) {
+			for (mask_i = 0; mask_i < MASK_DIM; mask_i++) {
+				for (level = 0; level < TSV_DENSITY_LEVELS; level++) {
+					masks_TSV_density[layer][mask_i][level] = this->thermal_masks_TSV_density[layer][level][mask_i];
+					mask_sum_TSV_density[mask_i][level] += masks_TSV_density[layer][mask_i][level];
+				}
+			}
+		}
 	}
 
 	/// perform 2D convolution by performing two separated 1D convolution iterations;
 	/// note that no (kernel) flipping is required since the mask is symmetric
 	//
 	// start w/ horizontal convolution (with which to start doesn't matter actually)
-	for (layer = 0; layer < layers; layer++) {
+	//
+	// walk power-map grid for horizontal convolution; store into thermal_map_tmp;
+	// note that during horizontal convolution we need to walk the full y-dimension
+	// related to the padded power map in order to reasonably model the thermal
+	// effect in the padding zone during subsequent vertical convolution
+	//
+	// for the x-dimension during horizontal convolution, we need to restrict the
+	// considered range according to the thermal map in order to exploit the padded
+	// power map w/o mask boundary checks
+	this->processColumns(MAP_DIM, layers, thread_pool, [&](int const& x_begin, int const& x_end) {
+		T mask_value;
+		// column of power map, for current mask element
+		T const* power_map_column;
+
+		for (int x = x_begin + PADDED_BINS; x < x_end + PADDED_BINS; x++) {
 
-		// walk power-map grid for horizontal convolution; store into
-		// thermal_map_tmp; note that during horizontal convolution we need to
-		// walk the full y-dimension related to the padded power map in order to
-		// reasonably model the thermal effect in the padding zone during
-		// subsequent vertical convolution
-		for (y = 0; y < ThermalAnalyzer::POWER_MAPS_DIM; y++) {
+			thermal_map_tmp[x].fill(0.0);
 
-			// for the x-dimension during horizontal convolution, we need to
-			// restrict the considered range according to the thermal map in
-			// order to exploit the padded power map w/o mask boundary checks
-			for (x = ThermalAnalyzer::POWER_MAPS_PADDED_BINS; x < ThermalAnalyzer::THERMAL_MAP_DIM + ThermalAnalyzer::POWER_MAPS_PADDED_BINS; x++) {
+			for (int layer = 0; layer < layers; layer++) {
 
 				// perform horizontal 1D convolution, i.e., multiply
-				// input[x] w/ mask
+				// input[x] w/ mask; for all y at once, i.e., mask element
+				// by mask element
 				//
-				// e.g., for x = 0, THERMAL_MASK_DIM = 3
+				// e.g., for x = 0, MASK_DIM = 3
 				// convol1D(x=0) = input[-1] * mask[0] + input[0] * mask[1] + input[1] * mask[2]
 				//
 				// can be also illustrated by aligning and multiplying
@@ -587,100 +889,114 @@ void ThermalAnalyzer::performPowerBlurring(Temp& ret, int const& layers, MaskPar
 				// mask:
 				// |m=0 |m=1|m=2|
 				//
-				for (mask_i = 0; mask_i < ThermalAnalyzer::THERMAL_MASK_DIM; mask_i++) {
+				for (int mask_i = 0; mask_i < MASK_DIM; mask_i++) {
 
-					// determine power-map index; note that it is not
-					// out of range due to the padded power maps
-					i = x + (mask_i - ThermalAnalyzer::THERMAL_MASK_CENTER);
+					int const i = x + (mask_i - MASK_CENTER);
 
-					if (ThermalAnalyzer::DBG) {
+					// power-map column; note that it is not out of
+					// range due to the padded power maps
+					power_map_column = power_maps[layer] + i * MAPS_DIM;
 
-						// mass of dbg messages; only for insane
-						// flag
-						if (ThermalAnalyzer::DBG_INSANE) {
-							cout << "DBG> y=" << y << ", x=" << x << ", mask_i=" << mask_i << ", i=" << i << endl;
-						}
+					// TSV-density-aware masks; the mask is selected
+					// for each power-map bin, i.e., heat source,
+					// according to the bin's TSV-density level
+					if (this->TSV_density_masks && this->TSV_density_columns[layer][i]) {
 
-						if (i < 0 || i >= ThermalAnalyzer::POWER_MAPS_DIM) {
-							cout << "DBG> Convolution data error; i out of range (should be limited by x)" << endl;
+						T const* mask_values = masks_TSV_density[layer][mask_i].data();
+						unsigned char const* levels_column = this->TSV_density_levels[layer].data() + i * MAPS_DIM;
+
+						for (int y = 0; y < MAPS_DIM; y++) {
+							thermal_map_tmp[x][y] += power_map_column[y] * mask_values[levels_column[y]];
 						}
 					}
+					// default masks, also for columns w/o any TSVs
+					else {
+						mask_value = masks[layer][mask_i];
 
-					// convolution; multiplication of mask element and
-					// power-map bin
-					thermal_map_tmp[x][y] +=
-						this->power_maps[layer][i][y].power_density *
-						this->thermal_masks[layer][mask_i];
+						// convolution; multiplication of mask element
+						// and power-map bins
+						for (int y = 0; y < MAPS_DIM; y++) {
+							thermal_map_tmp[x][y] += power_map_column[y] * mask_value;
+						}
+					}
 				}
 			}
 		}
-	}
+	});
 
 	// continue w/ vertical convolution; here we convolute the temp thermal map (sized
 	// like the padded power map) w/ the thermal masks in order to obtain the final
-	// thermal map (sized like a non-padded power map)
-	for (layer = 0; layer < layers; layer++) {
-
-		// walk power-map grid for vertical convolution; convolute mask w/ data
-		// obtained by horizontal convolution (thermal_map_tmp)
-		for (x = ThermalAnalyzer::POWER_MAPS_PADDED_BINS; x < ThermalAnalyzer::THERMAL_MAP_DIM + ThermalAnalyzer::POWER_MAPS_PADDED_BINS; x++) {
+	// thermal map (sized like a non-padded power map). Note that the temp thermal map
+	// is shared by all layers' masks, thus the vertical convolutions w/ each layer's
+	// mask can be summed up into one convolution w/ the sum of all masks
+	this->processColumns(MAP_DIM, layers, thread_pool, [&](int const& x_begin, int const& x_end) {
+		T mask_value;
+		// column of final thermal map, buffer for vertical convolution
+		array<T, MAP_DIM> thermal_map_column;
 
-			// index for final thermal map, considers padding offset
-			map_x = x - ThermalAnalyzer::POWER_MAPS_PADDED_BINS;
+		for (int map_x = x_begin; map_x < x_end; map_x++) {
 
-			for (y = ThermalAnalyzer::POWER_MAPS_PADDED_BINS; y < ThermalAnalyzer::THERMAL_MAP_DIM + ThermalAnalyzer::POWER_MAPS_PADDED_BINS; y++) {
+			// index for temp thermal map, considers padding offset
+			int const x = map_x + PADDED_BINS;
 
-				// index for final thermal map, considers padding offset
-				map_y = y - ThermalAnalyzer::POWER_MAPS_PADDED_BINS;
+			thermal_map_column.fill(0.0);
 
-				// perform 1D vertical convolution
-				for (mask_i = 0; mask_i < ThermalAnalyzer::THERMAL_MASK_DIM; mask_i++) {
+			// perform 1D vertical convolution; for all y at once, i.e., mask
+			// element by mask element. Note that the index for the temp
+			// thermal map, y + PADDED_BINS + (mask_i - MASK_CENTER),
+			// simplifies to y + mask_i
+			//
+			// for TSV-density-aware masks, the temp thermal map comprises
+			// the heat of all layers, thus the masks are selected according
+			// to the TSV-density levels averaged across all layers
+			if (this->TSV_density_masks && this->TSV_density_columns_stack[x]) {
 
-					// determine power-map index; note that it is not
-					// out of range due to the temp thermal map (sized
-					// like the padded power map)
-					i = y + (mask_i - ThermalAnalyzer::THERMAL_MASK_CENTER);
+				unsigned char const* levels_column = this->TSV_density_levels_stack.data() + x * MAPS_DIM;
 
-					if (ThermalAnalyzer::DBG) {
+				for (int mask_i = 0; mask_i < MASK_DIM; mask_i++) {
 
-						// mass of dbg messages; only for insane
-						// flag
-						if (ThermalAnalyzer::DBG_INSANE) {
-							cout << "DBG> x=" << x << ", y=" << y << ", map_x=" << map_x << ", map_y=" << map_y;
-							cout << ", mask_i=" << mask_i << ", i=" << i << endl;
-						}
+					T const* mask_values = mask_sum_TSV_density[mask_i].data();
 
-						if (i < 0 || i >= ThermalAnalyzer::POWER_MAPS_DIM) {
-							cout << "DBG> Convolution data error; i out of range (should be limited by y)" << endl;
-						}
+					for (int y = 0; y < MAP_DIM; y++) {
+						thermal_map_column[y] += thermal_map_tmp[x][y + mask_i] * mask_values[levels_column[y + mask_i]];
 					}
+				}
+			}
+			else {
+				for (int mask_i = 0; mask_i < MASK_DIM; mask_i++) {
+
+					mask_value = mask_sum[mask_i];
 
-					// convolution; multiplication of mask element and
-					// power-map bin
-					this->thermal_map[map_x][map_y] +=
-						thermal_map_tmp[x][i] *
-						this->thermal_masks[layer][mask_i];
+					for (int y = 0; y < MAP_DIM; y++) {
+						thermal_map_column[y] += thermal_map_tmp[x][y + mask_i] * mask_value;
+					}
 				}
 			}
+
+			// final map; consider temperature offset. Temperature offset is
+			// expected to be equal for all cases, i.e., independent of TSV
+			// density / assuming zero TSVs; this is required for resonable
+			// values w/o gaps at boundary bins w/ different thermal masks.
+			// Note that temperature offset is a additive factor, and thus not
+			// considered during convolution.
+			for (int y = 0; y < MAP_DIM; y++) {
+				this->thermal_map[map_x][y] = parameters.temp_offset + thermal_map_column[y];
+			}
 		}
-	}
+	});
 
 	// determine max and avg value
 	max_temp = avg_temp = 0.0;
-	for (x = 0; x < ThermalAnalyzer::THERMAL_MAP_DIM; x++) {
-		for (y = 0; y < ThermalAnalyzer::THERMAL_MAP_DIM; y++) {
+	for (x = 0; x < MAP_DIM; x++) {
+		for (y = 0; y < MAP_DIM; y++) {
 			max_temp = max(max_temp, this->thermal_map[x][y]);
 			avg_temp += this->thermal_map[x][y];
 		}
 	}
-	avg_temp /= pow(ThermalAnalyzer::THERMAL_MAP_DIM, 2);
+	avg_temp /= pow(MAP_DIM, 2);
 
 	// determine cost: max temp estimation, weighted w/ avg temp
 	ret.cost_temp = avg_temp * max_temp;
 	// store max temp
 	ret.max_temp = max_temp;
-
-	if (ThermalAnalyzer::DBG_CALLS) {
-		cout << "<- ThermalAnalyzer::performPowerBlurring" << endl;
-	}
 }
@@ -32,6 +32,7 @@
 class Point;
 class Net;
 class CorblivarAlignmentReq;
+class ThreadPool;
 
 class ThermalAnalyzer {
 	// debugging code switch (private)
@@ -51,10 +52,6 @@ class ThermalAnalyzer {
 			double power_density_scaling_TSV_region;
 			double temp_offset;
 		};
-		struct PowerMapBin {
-			double power_density;
-			double TSV_density;
-		};
 		struct Temp {
 			double cost_temp;
 			double max_temp;
@@ -63,22 +60,30 @@ class ThermalAnalyzer {
 	// private data, functions
 	private:
 
-		// thermal modeling: dimensions
+		// thermal modeling: dimensions; selected at runtime from the resolutions
+		// below, see initResolution()
 		// represents the thermal map's dimension
-		static constexpr int THERMAL_MAP_DIM = 64;
+		int thermal_map_dim;
 		// represents the thermal mask's dimension (i.e., the 2D gauss function
 		// representing the thermal impulse response);
 		// note that value should be uneven!
-		static constexpr int THERMAL_MASK_DIM = 11;
+		int thermal_mask_dim;
 		// represents the center index of the center originated mask; int division
 		// discards remainder, i.e., is equal to floor() for positive int
-		static constexpr int THERMAL_MASK_CENTER = THERMAL_MASK_DIM / 2;
+		int thermal_mask_center;
 		// represents the amount of padded bins at power maps' boundaries
-		static constexpr int POWER_MAPS_PADDED_BINS = THERMAL_MASK_CENTER;
+		int power_maps_padded_bins;
 		// represents the power maps' dimension
 		// (note that maps are padded at the boundaries according to mask
 		// dim in order to handle boundary values for convolution)
-		static constexpr int POWER_MAPS_DIM = THERMAL_MAP_DIM + (THERMAL_MASK_DIM - 1);
+		int power_maps_dim;
+
+		// thermal modeling: supported resolutions, i.e., pairs of thermal-map
+		// and thermal-mask dimensions; the power blurring is specialized for
+		// each of these pairs
+		static constexpr int RESOLUTIONS = 4;
+		static constexpr int RESOLUTIONS_MAP_DIM[RESOLUTIONS] = {32, 64, 128, 128};
+		static constexpr int RESOLUTIONS_MASK_DIM[RESOLUTIONS] = {11, 11, 15, 21};
 
 		// thermal modeling: thermal masks and maps
 		// thermal_masks[i][x/y], whereas thermal_masks[0] relates to the mask for
@@ -86,20 +91,113 @@ class ThermalAnalyzer {
 		// thermal_masks[1] relates to the mask for layer 0 obtained by
 		// considering heat source in layer 1 and so forth.  Note that the masks
 		// are only 1D for the separated convolution.
-		vector< array<double,THERMAL_MASK_DIM> > thermal_masks;
-		// power_maps[i][x][y], whereas power_maps[0] relates to the map for layer
-		// 0 and so forth.
-		vector< array<array<PowerMapBin, POWER_MAPS_DIM>, POWER_MAPS_DIM> > power_maps;
+		vector< vector<double> > thermal_masks;
+		// TSV-density-aware thermal masks, if activated: masks are precomputed
+		// for quantized TSV densities, i.e., TSV_DENSITY_LEVELS levels evenly
+		// covering [0, 100] percent; thermal_masks_TSV_density[i][level][x/y]
+		// relates to layer i like thermal_masks, whereas level 0 equals
+		// thermal_masks
+		static constexpr int TSV_DENSITY_LEVELS = 11;
+		bool TSV_density_masks;
+		vector< vector< vector<double> > > thermal_masks_TSV_density;
+		// power maps, separated into planes for power densities and TSV
+		// densities, since the power blurring only requires the former;
+		// power_density_maps[i] relates to the map for layer i and so forth.
+		// Each plane is contiguous, the bins are indexed by bin(x, y)
+		vector< vector<double> > power_density_maps, TSV_density_maps;
 		// thermal map for layer 0 (lowest layer), i.e., hottest layer
-		array<array<double,THERMAL_MAP_DIM>,THERMAL_MAP_DIM> thermal_map;
+		vector< vector<double> > thermal_map;
+		// power_maps_deltas[i]; 2D difference arrays for power maps, i.e.,
+		// the prefix sums over these arrays provide the power maps' power
+		// densities; indexed like power maps
+		vector< vector<double> > power_maps_deltas;
+		// quantized TSV densities, i.e., levels for selecting the
+		// TSV-density-aware masks, indexed like power maps; separate plane for
+		// the TSV densities averaged across all layers. Flags mark the columns
+		// w/ any non-zero level, all other columns are blurred w/ the level-0
+		// masks
+		vector< vector<unsigned char> > TSV_density_levels, TSV_density_columns;
+		vector<unsigned char> TSV_density_levels_stack, TSV_density_columns_stack;
+		inline static unsigned char TSVDensityLevel(double const& TSV_density) {
+			return static_cast<unsigned char>((TSV_density / 100.0) * (TSV_DENSITY_LEVELS - 1) + 0.5);
+		};
+
+		// index of power-map bin (x, y) within planes; bins of one column,
+		// i.e., for one x, are contiguous
+		inline int bin(int const& x, int const& y) const {
+			return x * this->power_maps_dim + y;
+		};
+		// scale power density of bin (x, y); also updates the related
+		// single-precision plane, if given
+		inline void scalePowerDensity(vector<double>& map, float* map_float, int const& x, int const& y, double const& factor) const {
+			map[this->bin(x, y)] *= factor;
+			if (map_float != nullptr) {
+				map_float[this->bin(x, y)] = map[this->bin(x, y)];
+			}
+		};
+
+		// thermal modeling: power blurring, specialized for the selected
+		// resolution and for the floating-point type T used for convolution,
+		// i.e., either double or float
+		typedef void (ThermalAnalyzer::*PowerBlurring)(Temp& ret, int const& layers, MaskParameters const& parameters, ThreadPool* thread_pool);
+		PowerBlurring power_blurring;
+		bool single_precision;
+		template<typename T>
+		static PowerBlurring specializedPowerBlurring(int const& thermal_map_dim, int const& thermal_mask_dim);
+		template<int MAP_DIM, int MASK_DIM, typename T>
+		void performPowerBlurringSpecialized(Temp& ret, int const& layers, MaskParameters const& parameters, ThreadPool* thread_pool);
+		// power-density planes in single precision, only allocated for the
+		// float convolution; written along w/ the final power densities by the
+		// power-map generation and adaption, indexed like power maps
+		vector< vector<float> > power_density_maps_float;
+		// power-density plane of layer, in floating-point type used for
+		// convolution
+		inline double const* powerDensityPlane(int const& layer, double*) const {
+			return this->power_density_maps[layer].data();
+		};
+		inline float const* powerDensityPlane(int const& layer, float*) const {
+			return this->power_density_maps_float[layer].data();
+		};
+
+		// parallel processing: per-layer steps of power-map generation and
+		// adaption are run concurrently for layers; power blurring is run
+		// concurrently for ranges of thermal-map columns. Stacks w/ less
+		// layers are processed sequentially, the pool's dispatch overhead would
+		// outweigh the gains otherwise. The thread pool may be nullptr
+		static constexpr int PARALLEL_MIN_LAYERS = 3;
+		void processLayers(int const& layers, ThreadPool* thread_pool, function<void(unsigned const&)> const& task);
+		void processColumns(int const& dim, int const& layers, ThreadPool* thread_pool, function<void(int const&, int const&)> const& task);
+
+		// per-layer steps of power-map generation and adaption, see
+		// generatePowerMaps() and adaptPowerMaps()
+		void generatePowerMap(int const& layer, vector<Block> const& blocks, Point const& die_outline, MaskParameters const& parameters,
+				bool const& extend_boundary_blocks_into_padding_zone);
+		void adaptPowerMap(int const& layer, vector<TSV_Group> const& TSVs, vector<Net> const& nets, MaskParameters const& parameters);
 
 		// thermal modeling: parameters for generating power maps
 		double power_maps_dim_x, power_maps_dim_y;
 		double power_maps_bin_area;
 		double blocks_offset_x, blocks_offset_y;
 		double padding_right_boundary_blocks_distance, padding_upper_boundary_blocks_distance;
-		array<double, POWER_MAPS_DIM + 1> power_maps_bins_ll_x, power_maps_bins_ll_y;
+		vector<double> power_maps_bins_ll_x, power_maps_bins_ll_y;
 		static constexpr double PADDING_ZONE_BLOCKS_DISTANCE_LIMIT = 0.01;
+
+		// thermal modeling: 1D coverage deltas for an interval [lower, upper],
+		// given in bins; i.e., the prefix sum over the deltas provides the
+		// fractional coverage of each bin by the interval. Note that the
+		// deltas for 2D coverages are the products of the deltas in x- and
+		// y-dimension
+		inline static void coverageDeltas(double const& lower, double const& upper, array<int, 4>& bins, array<double, 4>& deltas) {
+			int lower_bin, upper_bin;
+
+			// note that cast to int truncates toward zero, i.e., performs like
+			// floor for positive numbers
+			lower_bin = static_cast<int>(lower);
+			upper_bin = static_cast<int>(upper);
+
+			bins = {{lower_bin, lower_bin + 1, upper_bin, upper_bin + 1}};
+			deltas = {{1.0 - (lower - lower_bin), lower - lower_bin, (upper - upper_bin) - 1.0, -(upper - upper_bin)}};
+		};
 		/// material parameters for thermal 3D-IC simulation using HotSpot
 		/// Note: properties for heat spread and heat sink also from [Park09] (equal default
 		/// HotSpot configuration values)
@@ -197,19 +295,39 @@ class ThermalAnalyzer {
 
 	// constructors, destructors, if any non-implicit
 	public:
+		ThermalAnalyzer() {
+			this->power_blurring = nullptr;
+			this->single_precision = false;
+			this->TSV_density_masks = false;
+		};
 
 	// public data, functions
 	public:
 		friend class IO;
+		friend class ThermalSolver;
 
 		// thermal modeling: handlers
-		void initThermalMasks(int const& layers, bool const& log, MaskParameters const& parameters);
+		static bool supportedResolution(int const& thermal_map_dim, int const& thermal_mask_dim);
+		static void coarseResolution(int const& thermal_map_dim, int const& thermal_mask_dim, int const& factor, int& coarse_map_dim, int& coarse_mask_dim);
+		void initResolution(int const& thermal_map_dim, int const& thermal_mask_dim, bool const& single_precision = false);
+		void initThermalMasks(int const& layers, bool const& log, MaskParameters const& parameters, bool const& TSV_density_masks = false);
 		void initPowerMaps(int const& layers, Point const& die_outline);
-		void generatePowerMaps(int const& layers, vector<Block> const& blocks, Point const& die_outline, MaskParameters const& parameters, bool const& extend_boundary_blocks_into_padding_zone = true);
-		void adaptPowerMaps(int const& layers, vector<TSV_Group> const& TSVs, vector<Net> const& nets, MaskParameters const& parameters);
+		void generatePowerMaps(int const& layers, vector<Block> const& blocks, Point const& die_outline, MaskParameters const& parameters, bool const& extend_boundary_blocks_into_padding_zone = true,
+				ThreadPool* thread_pool = nullptr);
+		// note that the nets' bounding boxes are expected to be updated for
+		// the current layout, see Net::updateBoundingBoxes
+		void adaptPowerMaps(int const& layers, vector<TSV_Group> const& TSVs, vector<Net> const& nets, MaskParameters const& parameters, ThreadPool* thread_pool = nullptr);
 		// thermal-analyzer routine based on power blurring,
 		// i.e., convolution of thermals masks and power maps
-		void performPowerBlurring(Temp& ret, int const& layers, MaskParameters const& parameters);
+		void performPowerBlurring(Temp& ret, int const& layers, MaskParameters const& parameters, ThreadPool* thread_pool = nullptr);
+
+		// getter
+		inline int const& getThermalMapDim() const {
+			return this->thermal_map_dim;
+		};
+		inline vector< vector<double> > const& getThermalMap() const {
+			return this->thermal_map;
+		};
 };
 
 #endif
@@ -0,0 +1,681 @@
+/*
+ * =====================================================================================
+ *
+ *    Description:  Corblivar thermal solver, grid-based steady-state thermal analysis
+ *
+ *    Copyright (C) 2013 Johann Knechtel, johann.knechtel@ifte.de, www.ifte.de
+ *
+ *    This file is part of Corblivar.
+ *
+ *    Corblivar is free software: you can redistribute it and/or modify it under the terms
+ *    of the GNU General Public License as published by the Free Software Foundation,
+ *    either version 3 of the License, or (at your option) any later version.
+ *
+ *    Corblivar is distributed in the hope that it will be useful, but WITHOUT ANY
+ *    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *    PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License along with
+ *    Corblivar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * =====================================================================================
+ */
+
+// own Corblivar header
+#include "ThermalSolver.hpp"
+// required Corblivar headers
+#include "Block.hpp"
+#include "Chip.hpp"
+#include "ThreadPool.hpp"
+
+void ThermalSolver::performSteadyStateAnalysis(Result& ret, int const& layers, Point const& die_outline, vector<Block> const& blocks,
+		ThermalAnalyzer const& analyzer, ThermalAnalyzer::MaskParameters const& parameters, bool const& uniform_TSV_density,
+		ThreadPool* thread_pool, bool const& log) {
+	unsigned l;
+	int i, x, y, d;
+	int dim, cells;
+	double b_norm, r_norm;
+	double rz, rz_prev, pq;
+	double alpha, beta;
+
+	if (ThermalSolver::DBG_CALLS) {
+		cout << "-> ThermalSolver::performSteadyStateAnalysis(" << &ret << ", " << layers << ", " << die_outline.x << ", " << die_outline.y;
+		cout << ", " << &blocks << ", " << &analyzer << ", " << &parameters << ", " << uniform_TSV_density << ", " << thread_pool << ", " << log << ")" << endl;
+	}
+
+	if (log) {
+		cout << "ThermalSolver> Performing grid-based steady-state thermal analysis ..." << endl;
+	}
+
+	this->thread_pool = thread_pool;
+
+	// init grid levels, i.e., conductances and power sources
+	this->initGrid(layers, die_outline, blocks, analyzer, parameters, uniform_TSV_density);
+
+	dim = this->grid_dim;
+	cells = dim * dim * this->grid_layers;
+
+	// (re)allocate PCG vectors; previous temperatures are kept as initial guess
+	// as long as the grid remains the same
+	if (static_cast<int>(this->temp.size()) != cells) {
+		this->temp.assign(cells, 0.0);
+	}
+	this->pcg_r.resize(cells);
+	this->pcg_z.resize(cells);
+	this->pcg_p.resize(cells);
+	this->pcg_q.resize(cells);
+
+	Level& fine = this->levels[0];
+
+	/// preconditioned conjugate gradient
+	//
+	// initial residual r = b - G * T
+	this->applyConductances(fine, this->temp, this->pcg_r, &fine.b);
+
+	b_norm = sqrt(this->dotProduct(dim, fine.b, fine.b));
+	r_norm = sqrt(this->dotProduct(dim, this->pcg_r, this->pcg_r));
+
+	// trivial case, i.e., no power dissipated
+	if (b_norm == 0.0) {
+		fill(this->temp.begin(), this->temp.end(), 0.0);
+		r_norm = 0.0;
+		b_norm = 1.0;
+	}
+
+	// initial search direction; preconditioned residual
+	fine.b.swap(this->pcg_r);
+	this->VCycle(0);
+	fine.b.swap(this->pcg_r);
+	this->pcg_z = fine.x;
+	this->pcg_p = this->pcg_z;
+	rz = this->dotProduct(dim, this->pcg_r, this->pcg_z);
+
+	ret.iterations = 0;
+	while (r_norm / b_norm > ThermalSolver::PCG_TOLERANCE && ret.iterations < ThermalSolver::PCG_MAX_ITERATIONS) {
+
+		ret.iterations++;
+
+		// q = G * p
+		this->applyConductances(fine, this->pcg_p, this->pcg_q);
+		pq = this->dotProduct(dim, this->pcg_p, this->pcg_q);
+
+		alpha = rz / pq;
+
+		// update temperatures and residual
+		this->parallelize(dim, [&](int const& x_begin, int const& x_end, unsigned const& task) {
+			int i;
+			double sum = 0.0;
+
+			for (i = x_begin * dim * this->grid_layers; i < x_end * dim * this->grid_layers; i++) {
+				this->temp[i] += alpha * this->pcg_p[i];
+				this->pcg_r[i] -= alpha * this->pcg_q[i];
+				sum += this->pcg_r[i] * this->pcg_r[i];
+			}
+
+			this->partial_sums[task] = sum;
+		});
+		r_norm = 0.0;
+		for (double const& sum : this->partial_sums) {
+			r_norm += sum;
+		}
+		r_norm = sqrt(r_norm);
+
+		if (ThermalSolver::DBG) {
+			cout << "DBG_THERMAL_SOLVER> PCG iteration " << ret.iterations << "; relative residual: " << r_norm / b_norm << endl;
+		}
+
+		if (r_norm / b_norm <= ThermalSolver::PCG_TOLERANCE) {
+			break;
+		}
+
+		// preconditioned residual z = M^-1 * r
+		fine.b.swap(this->pcg_r);
+		this->VCycle(0);
+		fine.b.swap(this->pcg_r);
+		this->pcg_z.swap(fine.x);
+
+		rz_prev = rz;
+		rz = this->dotProduct(dim, this->pcg_r, this->pcg_z);
+		beta = rz / rz_prev;
+
+		// update search direction
+		this->parallelize(dim, [&](int const& x_begin, int const& x_end, unsigned const&) {
+			int i;
+
+			for (i = x_begin * dim * this->grid_layers; i < x_end * dim * this->grid_layers; i++) {
+				this->pcg_p[i] = this->pcg_z[i] + beta * this->pcg_p[i];
+			}
+		});
+	}
+
+	ret.residual = r_norm / b_norm;
+
+	// extract thermal maps for active Si layers; temperatures are relative to
+	// ambient
+	this->thermal_maps.assign(layers, vector< vector<double> >(dim, vector<double>(dim)));
+	for (d = 0; d < layers; d++) {
+
+		l = d * ThermalSolver::LAYERS_PER_DIE + ThermalSolver::LAYER_SI_ACTIVE;
+
+		for (x = 0; x < dim; x++) {
+			for (y = 0; y < dim; y++) {
+
+				i = (x * dim + y) * this->grid_layers + l;
+				this->thermal_maps[d][x][y] = this->temp[i] + ThermalSolver::AMBIENT_TEMP;
+			}
+		}
+	}
+
+	// max temp for lowest layer
+	ret.max_temp = 0.0;
+	for (x = 0; x < dim; x++) {
+		for (y = 0; y < dim; y++) {
+			ret.max_temp = max(ret.max_temp, this->thermal_maps[0][x][y]);
+		}
+	}
+
+	if (log) {
+		cout << "ThermalSolver> Done; PCG iterations: " << ret.iterations << ", relative residual: " << ret.residual << endl;
+	}
+
+	if (ThermalSolver::DBG_CALLS) {
+		cout << "<- ThermalSolver::performSteadyStateAnalysis" << endl;
+	}
+}
+
+void ThermalSolver::initGrid(int const& layers, Point const& die_outline, vector<Block> const& blocks,
+		ThermalAnalyzer const& analyzer, ThermalAnalyzer::MaskParameters const& parameters, bool const& uniform_TSV_density) {
+	int i, x, y, l, d;
+	int dim, cells;
+	int x_lower, x_upper, y_lower, y_upper;
+	double bin_x, bin_y, bin_area;
+	double overlap_x, overlap_y;
+	double TSV_density;
+	vector<double> thickness;
+	vector<double> resistivity;
+	int layer_SI_passive, layer_bond;
+
+	dim = this->grid_dim = analyzer.thermal_map_dim;
+	this->grid_layers = ThermalSolver::LAYERS_PER_DIE * layers - 1 + 2;
+	cells = dim * dim * this->grid_layers;
+
+	// bin dimensions [m]
+	bin_x = die_outline.x / dim * ThermalSolver::SCALE_UM_M;
+	bin_y = die_outline.y / dim * ThermalSolver::SCALE_UM_M;
+	bin_area = bin_x * bin_y;
+
+	// layers' thickness; also init resistivity of cells w/ default values
+	thickness.resize(this->grid_layers);
+	for (d = 0; d < layers; d++) {
+		thickness[d * ThermalSolver::LAYERS_PER_DIE] = Chip::THICKNESS_BEOL;
+		thickness[d * ThermalSolver::LAYERS_PER_DIE + 1] = Chip::THICKNESS_SI_ACTIVE;
+		thickness[d * ThermalSolver::LAYERS_PER_DIE + 2] = Chip::THICKNESS_SI_PASSIVE;
+		if (d < layers - 1) {
+			thickness[d * ThermalSolver::LAYERS_PER_DIE + 3] = Chip::THICKNESS_BOND;
+		}
+	}
+	thickness[this->grid_layers - 2] = ThermalSolver::THICKNESS_SPREADER;
+	thickness[this->grid_layers - 1] = ThermalSolver::THICKNESS_SINK;
+
+	resistivity.resize(cells);
+	for (x = 0; x < dim; x++) {
+		for (y = 0; y < dim; y++) {
+
+			i = (x * dim + y) * this->grid_layers;
+
+			for (d = 0; d < layers; d++) {
+
+				layer_SI_passive = d * ThermalSolver::LAYERS_PER_DIE + 2;
+				layer_bond = d * ThermalSolver::LAYERS_PER_DIE + 3;
+
+				// TSV density in percent; for thermal-analysis fitting
+				// runs, one common density is considered, similar to the
+				// HotSpot files
+				if (uniform_TSV_density) {
+					TSV_density = parameters.TSV_density;
+				}
+				else {
+					TSV_density = analyzer.TSV_density_maps[d][analyzer.bin(x + analyzer.power_maps_padded_bins, y + analyzer.power_maps_padded_bins)];
+				}
+				// overlapping TSV groups may result in larger densities
+				TSV_density = min(TSV_density, 100.0);
+
+				resistivity[i + d * ThermalSolver::LAYERS_PER_DIE] = ThermalAnalyzer::THERMAL_RESISTIVITY_BEOL;
+				resistivity[i + d * ThermalSolver::LAYERS_PER_DIE + ThermalSolver::LAYER_SI_ACTIVE] = ThermalAnalyzer::THERMAL_RESISTIVITY_SI;
+				resistivity[i + layer_SI_passive] = ThermalAnalyzer::thermResSi(TSV_density);
+				if (d < layers - 1) {
+					resistivity[i + layer_bond] = ThermalAnalyzer::thermResBond(TSV_density);
+				}
+			}
+
+			resistivity[i + this->grid_layers - 2] = ThermalSolver::THERMAL_RESISTIVITY_SPREADER;
+			resistivity[i + this->grid_layers - 1] = ThermalSolver::THERMAL_RESISTIVITY_SINK;
+		}
+	}
+
+	// init finest level
+	this->levels.resize(1);
+	Level& fine = this->levels[0];
+
+	fine.dim = dim;
+	fine.G_x.assign(cells, 0.0);
+	fine.G_y.assign(cells, 0.0);
+	fine.G_z.assign(cells, 0.0);
+	fine.G_amb.assign(cells, 0.0);
+	fine.b.assign(cells, 0.0);
+	fine.x.assign(cells, 0.0);
+	fine.r.assign(cells, 0.0);
+
+	// conductances; derived from half-cell resistances in series
+	for (x = 0; x < dim; x++) {
+		for (y = 0; y < dim; y++) {
+			for (l = 0; l < this->grid_layers; l++) {
+
+				i = (x * dim + y) * this->grid_layers + l;
+
+				if (x < dim - 1) {
+					fine.G_x[i] = thickness[l] * bin_y / (0.5 * bin_x * (resistivity[i] + resistivity[i + dim * this->grid_layers]));
+				}
+				if (y < dim - 1) {
+					fine.G_y[i] = thickness[l] * bin_x / (0.5 * bin_y * (resistivity[i] + resistivity[i + this->grid_layers]));
+				}
+				if (l < this->grid_layers - 1) {
+					fine.G_z[i] = bin_area / (0.5 * (thickness[l] * resistivity[i] + thickness[l + 1] * resistivity[i + 1]));
+				}
+				// heat sink to ambient; the convection resistance is
+				// shared by all bins, i.e., the heat sink is only modelled
+				// below the die outline
+				else {
+					fine.G_amb[i] = 1.0 / (0.5 * thickness[l] * resistivity[i] / bin_area + ThermalSolver::RESISTANCE_CONVECTION * dim * dim);
+				}
+			}
+		}
+	}
+
+	// power sources in active Si layers; power is distributed according to the
+	// blocks' intersections w/ the bins; note that block parts outside the die
+	// outline are not considered
+	for (Block const& block : blocks) {
+
+		if (block.layer < 0 || block.layer >= layers) {
+			continue;
+		}
+
+		// note that cast to int truncates toward zero, i.e., performs like floor
+		// for positive numbers; +1 in order to efficiently emulate the result
+		// of ceil()
+		x_lower = max(0, static_cast<int>(block.bb.ll.x * ThermalSolver::SCALE_UM_M / bin_x));
+		y_lower = max(0, static_cast<int>(block.bb.ll.y * ThermalSolver::SCALE_UM_M / bin_y));
+		x_upper = min(dim, static_cast<int>(block.bb.ur.x * ThermalSolver::SCALE_UM_M / bin_x) + 1);
+		y_upper = min(dim, static_cast<int>(block.bb.ur.y * ThermalSolver::SCALE_UM_M / bin_y) + 1);
+
+		l = block.layer * ThermalSolver::LAYERS_PER_DIE + ThermalSolver::LAYER_SI_ACTIVE;
+
+		for (x = x_lower; x < x_upper; x++) {
+
+			overlap_x = min(block.bb.ur.x * ThermalSolver::SCALE_UM_M, (x + 1) * bin_x) - max(block.bb.ll.x * ThermalSolver::SCALE_UM_M, x * bin_x);
+			if (overlap_x <= 0.0) {
+				continue;
+			}
+
+			for (y = y_lower; y < y_upper; y++) {
+
+				overlap_y = min(block.bb.ur.y * ThermalSolver::SCALE_UM_M, (y + 1) * bin_y) - max(block.bb.ll.y * ThermalSolver::SCALE_UM_M, y * bin_y);
+				if (overlap_y <= 0.0) {
+					continue;
+				}
+
+				// power share according to intersection
+				fine.b[(x * dim + y) * this->grid_layers + l] += block.power() * (overlap_x * overlap_y) / (block.bb.area * ThermalSolver::SCALE_UM_M * ThermalSolver::SCALE_UM_M);
+			}
+		}
+	}
+
+	this->initDiagonal(fine);
+
+	// init coarse levels; coarsening is stopped for uneven dimensions
+	while (this->levels.back().dim % 2 == 0) {
+
+		this->levels.emplace_back(Level());
+		this->initCoarseLevel(this->levels[this->levels.size() - 2], this->levels.back());
+	}
+
+	if (ThermalSolver::DBG) {
+		cout << "DBG_THERMAL_SOLVER> Grid: " << dim << " x " << dim << " x " << this->grid_layers << "; multigrid levels: " << this->levels.size() << endl;
+	}
+}
+
+// coarse level, aggregating 2 x 2 cells of the fine level; vertical conductances and
+// conductances to ambient are summed up, lateral conductances across the coarse cells'
+// boundaries are summed up and halved, accounting for the doubled distance between
+// the coarse cells' centers
+void ThermalSolver::initCoarseLevel(Level const& fine, Level& coarse) {
+	int x, y, l;
+	int i, i_fine;
+	int cells;
+	int layers;
+	int fine_dim;
+
+	layers = this->grid_layers;
+	fine_dim = fine.dim;
+	coarse.dim = fine_dim / 2;
+	cells = coarse.dim * coarse.dim * layers;
+
+	coarse.G_x.assign(cells, 0.0);
+	coarse.G_y.assign(cells, 0.0);
+	coarse.G_z.assign(cells, 0.0);
+	coarse.G_amb.assign(cells, 0.0);
+	coarse.b.assign(cells, 0.0);
+	coarse.x.assign(cells, 0.0);
+	coarse.r.assign(cells, 0.0);
+
+	for (x = 0; x < coarse.dim; x++) {
+		for (y = 0; y < coarse.dim; y++) {
+			for (l = 0; l < layers; l++) {
+
+				i = (x * coarse.dim + y) * layers + l;
+				// lower-left fine cell
+				i_fine = (2 * x * fine_dim + 2 * y) * layers + l;
+
+				coarse.G_z[i] = fine.G_z[i_fine] + fine.G_z[i_fine + layers] + fine.G_z[i_fine + fine_dim * layers] + fine.G_z[i_fine + (fine_dim + 1) * layers];
+				coarse.G_amb[i] = fine.G_amb[i_fine] + fine.G_amb[i_fine + layers] + fine.G_amb[i_fine + fine_dim * layers] + fine.G_amb[i_fine + (fine_dim + 1) * layers];
+
+				// right fine cells' conductances toward next coarse cell
+				coarse.G_x[i] = 0.5 * (fine.G_x[i_fine + fine_dim * layers] + fine.G_x[i_fine + (fine_dim + 1) * layers]);
+				// upper fine cells' conductances toward next coarse cell
+				coarse.G_y[i] = 0.5 * (fine.G_y[i_fine + layers] + fine.G_y[i_fine + (fine_dim + 1) * layers]);
+			}
+		}
+	}
+
+	this->initDiagonal(coarse);
+}
+
+// sum up conductances for each cell; also init factors for tridiagonal solves of cell
+// columns
+void ThermalSolver::initDiagonal(Level& level) {
+	int x, y, l;
+	int i;
+	int cells;
+	int layers;
+	double m;
+
+	layers = this->grid_layers;
+	cells = level.dim * level.dim * layers;
+
+	level.G_diag.assign(cells, 0.0);
+	level.thomas_upper.assign(cells, 0.0);
+	level.thomas_diag_inv.assign(cells, 0.0);
+
+	for (x = 0; x < level.dim; x++) {
+		for (y = 0; y < level.dim; y++) {
+			for (l = 0; l < layers; l++) {
+
+				i = (x * level.dim + y) * layers + l;
+
+				level.G_diag[i] = level.G_x[i] + level.G_y[i] + level.G_z[i] + level.G_amb[i];
+
+				if (x > 0) {
+					level.G_diag[i] += level.G_x[i - level.dim * layers];
+				}
+				if (y > 0) {
+					level.G_diag[i] += level.G_y[i - layers];
+				}
+				if (l > 0) {
+					level.G_diag[i] += level.G_z[i - 1];
+				}
+
+				// Thomas algorithm; modified diagonal and upper diagonal
+				if (l == 0) {
+					m = level.G_diag[i];
+				}
+				else {
+					m = level.G_diag[i] - level.G_z[i - 1] * level.G_z[i - 1] * level.thomas_diag_inv[i - 1];
+				}
+
+				level.thomas_diag_inv[i] = 1.0 / m;
+				level.thomas_upper[i] = -level.G_z[i] / m;
+			}
+		}
+	}
+}
+
+void ThermalSolver::parallelize(int const& dim, function<void(int const&, int const&, unsigned const&)> const& task) {
+	unsigned tasks;
+
+	// sequential processing for small grids, or w/o thread pool
+	if (this->thread_pool == nullptr || dim * dim * this->grid_layers < ThermalSolver::PARALLEL_MIN_CELLS) {
+		tasks = 1;
+	}
+	else {
+		tasks = min(this->thread_pool->threads(), static_cast<unsigned>(dim));
+	}
+
+	this->partial_sums.assign(tasks, 0.0);
+
+	if (tasks == 1) {
+		task(0, dim, 0);
+	}
+	else {
+		this->thread_pool->run(tasks, [&](unsigned const& t) {
+			task(t * dim / tasks, (t + 1) * dim / tasks, t);
+		});
+	}
+}
+
+void ThermalSolver::applyConductances(Level const& level, vector<double> const& in, vector<double>& out, vector<double> const* rhs) {
+
+	this->parallelize(level.dim, [&](int const& x_begin, int const& x_end, unsigned const&) {
+		int x, y, l;
+		int i;
+		int layers, dim;
+		double sum;
+
+		layers = this->grid_layers;
+		dim = level.dim;
+
+		for (x = x_begin; x < x_end; x++) {
+			for (y = 0; y < dim; y++) {
+				for (l = 0; l < layers; l++) {
+
+					i = (x * dim + y) * layers + l;
+
+					sum = level.G_diag[i] * in[i];
+
+					if (l > 0) {
+						sum -= level.G_z[i - 1] * in[i - 1];
+					}
+					if (l < layers - 1) {
+						sum -= level.G_z[i] * in[i + 1];
+					}
+					if (x > 0) {
+						sum -= level.G_x[i - dim * layers] * in[i - dim * layers];
+					}
+					if (x < dim - 1) {
+						sum -= level.G_x[i] * in[i + dim * layers];
+					}
+					if (y > 0) {
+						sum -= level.G_y[i - layers] * in[i - layers];
+					}
+					if (y < dim - 1) {
+						sum -= level.G_y[i] * in[i + layers];
+					}
+
+					if (rhs != nullptr) {
+						out[i] = (*rhs)[i] - sum;
+					}
+					else {
+						out[i] = sum;
+					}
+				}
+			}
+		}
+	});
+}
+
+double ThermalSolver::dotProduct(int const& dim, vector<double> const& a, vector<double> const& b) {
+	double ret;
+
+	this->parallelize(dim, [&](int const& x_begin, int const& x_end, unsigned const& task) {
+		int i;
+		double sum = 0.0;
+
+		for (i = x_begin * dim * this->grid_layers; i < x_end * dim * this->grid_layers; i++) {
+			sum += a[i] * b[i];
+		}
+
+		this->partial_sums[task] = sum;
+	});
+
+	ret = 0.0;
+	for (double const& sum : this->partial_sums) {
+		ret += sum;
+	}
+
+	return ret;
+}
+
+// line smoother; solves the tridiagonal systems of all red or black cell columns,
+// considering the current values of the neighbouring columns. Since neighbouring
+// columns are of the other color, the columns of one color can be processed in
+// parallel
+void ThermalSolver::smooth(Level& level, int const& color) {
+
+	this->parallelize(level.dim, [&](int const& x_begin, int const& x_end, unsigned const&) {
+		int x, y, l;
+		int i, i_col;
+		int layers, dim;
+		double rhs;
+
+		layers = this->grid_layers;
+		dim = level.dim;
+
+		for (x = x_begin; x < x_end; x++) {
+			for (y = (x + color) % 2; y < dim; y += 2) {
+
+				i_col = (x * dim + y) * layers;
+
+				// forward elimination
+				for (l = 0; l < layers; l++) {
+
+					i = i_col + l;
+
+					rhs = level.b[i];
+
+					if (x > 0) {
+						rhs += level.G_x[i - dim * layers] * level.x[i - dim * layers];
+					}
+					if (x < dim - 1) {
+						rhs += level.G_x[i] * level.x[i + dim * layers];
+					}
+					if (y > 0) {
+						rhs += level.G_y[i - layers] * level.x[i - layers];
+					}
+					if (y < dim - 1) {
+						rhs += level.G_y[i] * level.x[i + layers];
+					}
+					if (l > 0) {
+						rhs += level.G_z[i - 1] * level.x[i - 1];
+					}
+
+					level.x[i] = rhs * level.thomas_diag_inv[i];
+				}
+
+				// backward substitution
+				for (l = layers - 2; l >= 0; l--) {
+
+					i = i_col + l;
+
+					level.x[i] -= level.thomas_upper[i] * level.x[i + 1];
+				}
+			}
+		}
+	});
+}
+
+// symmetric V-cycle, i.e., the smoothing order is reversed for post-smoothing;
+// solves G * x = b approximately for the given level, starting from x = 0
+void ThermalSolver::VCycle(unsigned const& level_id) {
+	int s;
+
+	Level& level = this->levels[level_id];
+
+	fill(level.x.begin(), level.x.end(), 0.0);
+
+	// coarsest level; for one column, the red-line solve is exact
+	if (level_id == this->levels.size() - 1) {
+
+		if (level.dim == 1) {
+			this->smooth(level, 0);
+		}
+		else {
+			for (s = 0; s < ThermalSolver::MG_COARSEST_SWEEPS; s++) {
+				this->smooth(level, 0);
+				this->smooth(level, 1);
+			}
+			for (s = 0; s < ThermalSolver::MG_COARSEST_SWEEPS; s++) {
+				this->smooth(level, 1);
+				this->smooth(level, 0);
+			}
+		}
+
+		return;
+	}
+
+	Level& coarse = this->levels[level_id + 1];
+
+	// pre-smoothing
+	this->smooth(level, 0);
+	this->smooth(level, 1);
+
+	// restriction of residual; sum up residuals of 2 x 2 fine cells
+	this->applyConductances(level, level.x, level.r, &level.b);
+
+	this->parallelize(coarse.dim, [&](int const& x_begin, int const& x_end, unsigned const&) {
+		int x, y, l;
+		int i, i_fine;
+		int layers;
+
+		layers = this->grid_layers;
+
+		for (x = x_begin; x < x_end; x++) {
+			for (y = 0; y < coarse.dim; y++) {
+				for (l = 0; l < layers; l++) {
+
+					i = (x * coarse.dim + y) * layers + l;
+					i_fine = (2 * x * level.dim + 2 * y) * layers + l;
+
+					coarse.b[i] = level.r[i_fine] + level.r[i_fine + layers] + level.r[i_fine + level.dim * layers] + level.r[i_fine + (level.dim + 1) * layers];
+				}
+			}
+		}
+	});
+
+	// coarse-level correction
+	this->VCycle(level_id + 1);
+
+	// prolongation of correction; constant for 2 x 2 fine cells
+	this->parallelize(level.dim, [&](int const& x_begin, int const& x_end, unsigned const&) {
+		int x, y, l;
+		int i, i_coarse;
+		int layers;
+
+		layers = this->grid_layers;
+
+		for (x = x_begin; x < x_end; x++) {
+			for (y = 0; y < level.dim; y++) {
+				for (l = 0; l < layers; l++) {
+
+					i = (x * level.dim + y) * layers + l;
+					i_coarse = ((x / 2) * coarse.dim + (y / 2)) * layers + l;
+
+					level.x[i] += coarse.x[i_coarse];
+				}
+			}
+		}
+	});
+
+	// post-smoothing
+	this->smooth(level, 1);
+	this->smooth(level, 0);
+}
@@ -0,0 +1,164 @@
+/*
+ * =====================================================================================
+ *
+ *    Description:  Corblivar thermal solver, grid-based steady-state thermal analysis
+ *
+ *    Copyright (C) 2013 Johann Knechtel, johann.knechtel@ifte.de, www.ifte.de
+ *
+ *    This file is part of Corblivar.
+ *
+ *    Corblivar is free software: you can redistribute it and/or modify it under the terms
+ *    of the GNU General Public License as published by the Free Software Foundation,
+ *    either version 3 of the License, or (at your option) any later version.
+ *
+ *    Corblivar is distributed in the hope that it will be useful, but WITHOUT ANY
+ *    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *    PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License along with
+ *    Corblivar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * =====================================================================================
+ */
+#ifndef _CORBLIVAR_THERMALSOLVER
+#define _CORBLIVAR_THERMALSOLVER
+
+// library includes
+#include "Corblivar.incl.hpp"
+// Corblivar includes, if any
+#include "ThermalAnalyzer.hpp"
+// forward declarations, if any
+class Block;
+class ThreadPool;
+
+// finite-difference model of the 3D-IC stack also considered for HotSpot runs, see
+// IO::writeHotSpotFiles; the steady-state temperatures are obtained by solving the
+// resulting sparse linear system w/ a conjugate-gradient solver, preconditioned by a
+// geometric multigrid V-cycle
+class ThermalSolver {
+	// debugging code switch (private)
+	private:
+		static constexpr bool DBG_CALLS = false;
+		static constexpr bool DBG = false;
+
+	// PODs, to be declared early on
+	public:
+		struct Result {
+			double max_temp;
+			int iterations;
+			double residual;
+		};
+
+	private:
+		// grid level for multigrid preconditioning; the lateral dimension is
+		// halved for each coarser level, whereas all stack layers are kept
+		//
+		// cells are indexed as (x * dim + y) * grid_layers + layer, i.e., the
+		// cells of one column (all layers for one bin) are contiguous
+		struct Level {
+			int dim;
+			// conductances [W/K] between each cell and its neighbours in x-,
+			// y-, and z-direction, i.e., the cells (x + 1, y, layer), (x, y +
+			// 1, layer), and (x, y, layer + 1); conductance to ambient
+			vector<double> G_x, G_y, G_z, G_amb;
+			// diagonal of conductance matrix, i.e., sum of all conductances
+			// of each cell
+			vector<double> G_diag;
+			// factors for tridiagonal solves of cell columns (Thomas
+			// algorithm), i.e., modified upper diagonal and inverse of
+			// modified diagonal
+			vector<double> thomas_upper, thomas_diag_inv;
+			// solution, right-hand side, residual
+			vector<double> x, b, r;
+		};
+
+	// private data, functions
+	private:
+		// package parameters, not covered by Chip; according to default
+		// configuration of HotSpot
+		//
+		// ambient temperature [K]
+		static constexpr double AMBIENT_TEMP = 318.15;
+		// Cu heat spreader; 1mm thick
+		static constexpr double THICKNESS_SPREADER = 1.0e-03;
+		static constexpr double THERMAL_RESISTIVITY_SPREADER = 2.5e-03;
+		// Cu heat sink; 6.9mm thick
+		static constexpr double THICKNESS_SINK = 6.9e-03;
+		static constexpr double THERMAL_RESISTIVITY_SINK = 2.5e-03;
+		// convection resistance of heat sink [K/W]
+		static constexpr double RESISTANCE_CONVECTION = 0.1;
+
+		// PCG parameters; relative residual to be reached and upper limit for
+		// iterations
+		static constexpr double PCG_TOLERANCE = 1.0e-08;
+		static constexpr int PCG_MAX_ITERATIONS = 500;
+		// multigrid parameters; smoothing sweeps on coarsest level, only
+		// required for grids which cannot be coarsened down to one column
+		static constexpr int MG_COARSEST_SWEEPS = 20;
+		// grids w/ less cells are processed sequentially
+		static constexpr int PARALLEL_MIN_CELLS = 16384;
+
+		// factor to scale um downto m
+		static constexpr double SCALE_UM_M = 1.0e-06;
+
+		// grid: lateral dimension equals thermal-map dimension; the stack
+		// comprises a BEOL, an active Si, a passive Si, and a bond layer for
+		// each die, except for the uppermost die which has no bond layer, and
+		// the heat spreader and heat sink on top
+		int grid_dim, grid_layers;
+		static constexpr int LAYERS_PER_DIE = 4;
+		static constexpr int LAYER_SI_ACTIVE = 1;
+
+		// grid levels, from finest to coarsest
+		vector<Level> levels;
+		// PCG vectors, related to finest level; the temperatures (relative to
+		// ambient) are also kept as initial guess for subsequent runs
+		vector<double> temp, pcg_r, pcg_z, pcg_p, pcg_q;
+
+		// parallel processing; thread pool may be nullptr
+		ThreadPool* thread_pool;
+		vector<double> partial_sums;
+
+		// grid setup
+		void initGrid(int const& layers, Point const& die_outline, vector<Block> const& blocks,
+				ThermalAnalyzer const& analyzer, ThermalAnalyzer::MaskParameters const& parameters, bool const& uniform_TSV_density);
+		void initCoarseLevel(Level const& fine, Level& coarse);
+		void initDiagonal(Level& level);
+
+		// processing of grid rows [x_begin, x_end) in parallel; partial_sums
+		// provides one entry per task
+		void parallelize(int const& dim, function<void(int const&, int const&, unsigned const&)> const& task);
+		// sparse matrix-vector product out = G * in, or residual out = rhs - G
+		// * in, if rhs is given
+		void applyConductances(Level const& level, vector<double> const& in, vector<double>& out, vector<double> const* rhs = nullptr);
+		double dotProduct(int const& dim, vector<double> const& a, vector<double> const& b);
+		// multigrid preconditioner; line smoother, i.e., exact solves of cell
+		// columns, for red or black columns
+		void smooth(Level& level, int const& color);
+		void VCycle(unsigned const& l);
+
+	// constructors, destructors, if any non-implicit
+	public:
+		ThermalSolver() {
+			this->grid_dim = this->grid_layers = 0;
+			this->thread_pool = nullptr;
+		};
+
+	// public data, functions
+	public:
+		friend class IO;
+
+		// thermal maps for all dies' active Si layers, i.e.,
+		// thermal_maps[i][x][y] relates to die i, given in K
+		vector< vector< vector<double> > > thermal_maps;
+
+		// steady-state thermal analysis; the TSV densities are obtained from
+		// the power maps of the analyzer, or are uniform according to the
+		// parameters. Returns max temp for lowest layer, as also estimated by
+		// power blurring
+		void performSteadyStateAnalysis(Result& ret, int const& layers, Point const& die_outline, vector<Block> const& blocks,
+				ThermalAnalyzer const& analyzer, ThermalAnalyzer::MaskParameters const& parameters, bool const& uniform_TSV_density,
+				ThreadPool* thread_pool, bool const& log);
+};
+
+#endif
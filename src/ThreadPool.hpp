@@ -0,0 +1,195 @@
+/*
+ * =====================================================================================
+ *
+ *    Description:  Corblivar thread pool, persistent workers for parallel tasks
+ *
+ *    Copyright (C) 2013 Johann Knechtel, johann.knechtel@ifte.de, www.ifte.de
+ *
+ *    This file is part of Corblivar.
+ *    
+ *    Corblivar is free software: you can redistribute it and/or modify it under the terms
+ *    of the GNU General Public License as published by the Free Software Foundation,
+ *    either version 3 of the License, or (at your option) any later version.
+ *    
+ *    Corblivar is distributed in the hope that it will be useful, but WITHOUT ANY
+ *    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *    PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *    
+ *    You should have received a copy of the GNU General Public License along with
+ *    Corblivar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * =====================================================================================
+ */
+#ifndef _CORBLIVAR_THREADPOOL
+#define _CORBLIVAR_THREADPOOL
+
+// library includes
+#include "Corblivar.incl.hpp"
+// Corblivar includes, if any
+// forward declarations, if any
+
+class ThreadPool {
+	// debugging code switch (private)
+	private:
+		static constexpr bool DBG = false;
+
+	// private data, functions
+	private:
+		// worker threads; note that the calling thread also processes tasks,
+		// i.e., the pool provides one additional worker
+		vector<thread> workers;
+
+		// current job, i.e., the task function and the task indices to be
+		// processed
+		function<void(unsigned const&)> const* task;
+		unsigned tasks, next_task, tasks_done;
+		// job counter; enables idle workers to detect new jobs
+		unsigned long job;
+		bool terminate;
+
+		// synchronization
+		mutex m;
+		condition_variable cv_job, cv_done;
+
+		// process tasks of current job until all tasks are assigned
+		inline void processTasks() {
+			function<void(unsigned const&)> const* cur_task;
+			unsigned cur_index;
+
+			while (true) {
+
+				// fetch next task index
+				{
+					lock_guard<mutex> lock(this->m);
+
+					if (this->next_task >= this->tasks) {
+						return;
+					}
+
+					cur_index = this->next_task++;
+					cur_task = this->task;
+				}
+
+				// process task
+				(*cur_task)(cur_index);
+
+				// memorize processed task; notify caller when job is done
+				{
+					lock_guard<mutex> lock(this->m);
+
+					this->tasks_done++;
+					if (this->tasks_done == this->tasks) {
+						this->cv_done.notify_all();
+					}
+				}
+			}
+		};
+
+		// main loop for worker threads; wait for new jobs and process them
+		inline void workerLoop() {
+			unsigned long prev_job = 0;
+
+			while (true) {
+
+				{
+					unique_lock<mutex> lock(this->m);
+
+					this->cv_job.wait(lock, [&]() {
+						return (this->terminate || this->job != prev_job);
+					});
+
+					if (this->terminate) {
+						return;
+					}
+
+					prev_job = this->job;
+				}
+
+				this->processTasks();
+			}
+		};
+
+	// constructors, destructors, if any non-implicit
+	public:
+		ThreadPool(unsigned const& threads) {
+
+			this->task = nullptr;
+			this->tasks = this->next_task = this->tasks_done = 0;
+			this->job = 0;
+			this->terminate = false;
+
+			for (unsigned t = 0; t < threads; t++) {
+				this->workers.push_back(thread(&ThreadPool::workerLoop, this));
+			}
+
+			if (ThreadPool::DBG) {
+				cout << "DBG_THREADS> Thread pool started; worker threads: " << threads << endl;
+			}
+		};
+
+		~ThreadPool() {
+
+			{
+				lock_guard<mutex> lock(this->m);
+				this->terminate = true;
+			}
+			this->cv_job.notify_all();
+
+			for (thread& t : this->workers) {
+				t.join();
+			}
+		};
+
+		// pool is not to be copied
+		ThreadPool(ThreadPool const&) = delete;
+		ThreadPool& operator= (ThreadPool const&) = delete;
+
+	// public data, functions
+	public:
+		// overall threads, including the calling thread
+		inline unsigned threads() const {
+			return this->workers.size() + 1;
+		};
+
+		// perform task(i) for all i in [0, tasks); returns after all tasks are
+		// done; the calling thread processes tasks as well
+		inline void run(unsigned const& tasks, function<void(unsigned const&)> const& task) {
+
+			// trivial case; process sequentially
+			if (this->workers.empty() || tasks == 1) {
+
+				for (unsigned i = 0; i < tasks; i++) {
+					task(i);
+				}
+
+				return;
+			}
+
+			// init new job
+			{
+				lock_guard<mutex> lock(this->m);
+
+				this->task = &task;
+				this->tasks = tasks;
+				this->next_task = this->tasks_done = 0;
+				this->job++;
+			}
+			this->cv_job.notify_all();
+
+			// also process tasks in calling thread
+			this->processTasks();
+
+			// wait for remaining tasks
+			{
+				unique_lock<mutex> lock(this->m);
+
+				this->cv_done.wait(lock, [&]() {
+					return (this->tasks_done == this->tasks);
+				});
+
+				this->task = nullptr;
+			}
+		};
+};
+
+#endif
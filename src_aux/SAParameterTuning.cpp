@@ -0,0 +1,337 @@
+/*
+ * =====================================================================================
+ *
+ *    Description:  Entry (main) for SA-parameter tuning of Corblivar
+ *
+ *    Copyright (C) 2013 Johann Knechtel, johann.knechtel@ifte.de, www.ifte.de
+ *
+ *    This file is part of Corblivar.
+ *    
+ *    Corblivar is free software: you can redistribute it and/or modify it under the terms
+ *    of the GNU General Public License as published by the Free Software Foundation,
+ *    either version 3 of the License, or (at your option) any later version.
+ *    
+ *    Corblivar is distributed in the hope that it will be useful, but WITHOUT ANY
+ *    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *    PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *    
+ *    You should have received a copy of the GNU General Public License along with
+ *    Corblivar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * =====================================================================================
+ */
+
+// required Corblivar headers
+#include "../src/CorblivarCore.hpp"
+#include "../src/FloorPlanner.hpp"
+#include "../src/IO.hpp"
+
+int main (int argc, char** argv) {
+	vector< unique_ptr<FloorPlanner> > benchmarks;
+	vector<char*> benchmark_argv;
+	stringstream benchmarks_list;
+	string benchmark;
+
+	cout << endl;
+	cout << "Corblivar: Corner Block List for Varied [Block] Alignment Requests" << endl;
+	cout << "----- SA-parameter tuning tool v1.0 ------------------------------" << endl << endl;
+
+	// set IO mode
+	IO::mode = IO::Mode::SA_TUNING;
+
+	// sanity check for program parameters; parsing prints usage and exits
+	if (argc < 4) {
+		FloorPlanner fp;
+		IO::parseParametersFiles(fp, argc, argv);
+	}
+
+	// the benchmarks are given as comma-separated list; each benchmark is parsed
+	// into its own floorplanner, w/ the further program parameters shared
+	benchmarks_list << argv[1];
+	benchmark_argv.assign(argv, argv + argc);
+
+	while (getline(benchmarks_list, benchmark, ',')) {
+
+		benchmarks.emplace_back(new FloorPlanner());
+		FloorPlanner& fp = *benchmarks.back();
+
+		benchmark_argv[1] = &benchmark[0];
+
+		// parse program parameter, config file, and further files
+		IO::parseParametersFiles(fp, argc, benchmark_argv.data());
+		// parse blocks
+		IO::parseBlocks(fp);
+		// parse nets
+		IO::parseNets(fp);
+
+		// init thermal analyzer, only reasonable after parsing config file
+		fp.initThermalAnalyzer();
+	}
+
+	// the first benchmark's floorplanner handles the tuning; init thread pool,
+	// used for parallel runs
+	benchmarks.front()->initThreadPool();
+
+	// race SA-parameter configurations, generate tuned config file
+	benchmarks.front()->tuneSAParameters(benchmarks);
+}
+
+void FloorPlanner::tuneSAParameters(vector< unique_ptr<FloorPlanner> > const& benchmarks) {
+	TuningPoint start_point;
+	vector<unsigned> remaining;
+	vector<TuningRun> runs;
+	vector< array<double, 5> > references;
+	vector<int> references_valid_runs;
+	unsigned b, c, r;
+	unsigned i;
+	int round;
+	struct timeb tuning_start, tuning_end;
+
+	if (FloorPlanner::DBG_CALLS_SA) {
+		cout << "-> FloorPlanner::tuneSAParameters(" << benchmarks.size() << ")" << endl;
+	}
+
+	ftime(&tuning_start);
+
+	if (this->logMin()) {
+		cout << "Corblivar> Tuning SA parameters across " << benchmarks.size() << " benchmarks ..." << endl;
+		cout << "Corblivar>  Configurations: " << this->tuning_configurations << ", runtime weight: " << this->tuning_runtime_weight << endl;
+	}
+
+	// configurations; the first one refers to the configured parameters, the
+	// others are randomly drawn around them. Configurations are determined
+	// beforehand in order to retain the sequential use of the random-number
+	// generator
+	start_point[0] = this->conf_SA_loopFactor;
+	start_point[1] = this->conf_SA_temp_init_factor;
+	start_point[2] = this->conf_SA_temp_factor_phase1;
+	start_point[3] = this->conf_SA_temp_factor_phase1_limit;
+	start_point[4] = this->conf_SA_temp_factor_phase2;
+	start_point[5] = this->conf_SA_temp_factor_phase3;
+
+	this->tuning_configs.clear();
+	for (c = 0; c < static_cast<unsigned>(this->tuning_configurations); c++) {
+		TuningConfiguration config;
+
+		if (c == 0) {
+			config.point = start_point;
+		}
+		else {
+			config.point[0] = start_point[0] + Math::randF(-FloorPlanner::TUNING_LOOP_FACTOR_RANGE, FloorPlanner::TUNING_LOOP_FACTOR_RANGE);
+			config.point[1] = start_point[1] * pow(10.0, Math::randF(-FloorPlanner::TUNING_TEMP_INIT_FACTOR_RANGE, FloorPlanner::TUNING_TEMP_INIT_FACTOR_RANGE));
+			// initial cooling factor for phase 1 has to be below the
+			// final one
+			config.point[2] = Math::randF(0.3, 0.8);
+			config.point[3] = Math::randF(config.point[2] + 0.05, 0.98);
+			config.point[4] = Math::randF(1.0, 1.3);
+			// reheating in phase 3 remains disabled, if so configured
+			config.point[5] = start_point[5] * Math::randF(0.5, 2.0);
+		}
+		config.avg_objective = 0.0;
+		config.dropped = 0;
+
+		this->tuning_configs.push_back(move(config));
+		remaining.push_back(c);
+	}
+
+	// rounds of racing
+	round = 1;
+	while (remaining.size() > 1) {
+
+		// runs of round; all remaining configurations for all benchmarks
+		runs.clear();
+		for (unsigned const& config : remaining) {
+			for (b = 0; b < benchmarks.size(); b++) {
+
+				TuningRun run;
+				run.config = config;
+				run.benchmark = b;
+				run.seed = Math::randSeed();
+
+				runs.push_back(move(run));
+			}
+		}
+
+		// parallel runs; each run operates on its own copy of the benchmark's
+		// floorplanner. Note that the runtimes are thus measured under load
+		function<void(unsigned const&)> perform = [&](unsigned const& r) {
+			Math::RandomEngine random_engine(runs[r].seed);
+			Math::RandomEngineScope random_scope(random_engine);
+
+			this->performTuningRun(runs[r], *benchmarks[runs[r].benchmark]);
+		};
+
+		if (this->thread_pool) {
+			this->thread_pool->run(runs.size(), perform);
+		}
+		else {
+			for (r = 0; r < runs.size(); r++) {
+				perform(r);
+			}
+		}
+
+		// reference values for normalization of objectives; avg values of all
+		// configurations' first runs, for each benchmark
+		if (round == 1) {
+
+			references.assign(benchmarks.size(), {{0.0, 0.0, 0.0, 0.0, 0.0}});
+			references_valid_runs.assign(benchmarks.size(), 0);
+
+			for (TuningRun const& run : runs) {
+
+				references[run.benchmark][4] += run.runtime / remaining.size();
+
+				if (run.valid) {
+					references[run.benchmark][0] += run.cost.HPWL_actual_value;
+					references[run.benchmark][1] += run.cost.TSVs_actual_value;
+					references[run.benchmark][2] += run.cost.thermal_actual_value - benchmarks[run.benchmark]->conf_power_blurring_parameters.temp_offset;
+					references[run.benchmark][3] += run.cost.alignments_actual_value;
+					references_valid_runs[run.benchmark]++;
+				}
+			}
+			for (b = 0; b < benchmarks.size(); b++) {
+				for (i = 0; i < 4 && references_valid_runs[b] > 0; i++) {
+					references[b][i] /= references_valid_runs[b];
+				}
+			}
+		}
+
+		// objectives of runs
+		for (TuningRun const& run : runs) {
+			this->tuning_configs[run.config].objectives.push_back(
+					this->evaluateTuningRun(run, *benchmarks[run.benchmark], references[run.benchmark]));
+		}
+
+		// rank remaining configurations by avg objective of all their runs
+		for (unsigned const& config : remaining) {
+
+			TuningConfiguration& cur_config = this->tuning_configs[config];
+
+			cur_config.avg_objective = 0.0;
+			for (double const& objective : cur_config.objectives) {
+				cur_config.avg_objective += objective;
+			}
+			cur_config.avg_objective /= cur_config.objectives.size();
+		}
+		sort(remaining.begin(), remaining.end(), [&](unsigned const& c1, unsigned const& c2) {
+			return this->tuning_configs[c1].avg_objective < this->tuning_configs[c2].avg_objective;
+		});
+
+		if (this->logMed()) {
+			cout << "Corblivar>  Round " << round << "; configurations: " << remaining.size() << ", runs: " << runs.size();
+			cout << "; best avg objective: " << this->tuning_configs[remaining.front()].avg_objective;
+			cout << " (configuration " << remaining.front() << ")" << endl;
+		}
+
+		// drop worse half
+		for (r = (remaining.size() + 1) / 2; r < remaining.size(); r++) {
+			this->tuning_configs[remaining[r]].dropped = round;
+		}
+		remaining.resize((remaining.size() + 1) / 2);
+
+		round++;
+	}
+
+	// apply tuned parameters
+	this->tuning_best = remaining.front();
+	TuningPoint const& best_point = this->tuning_configs[this->tuning_best].point;
+
+	this->conf_SA_loopFactor = best_point[0];
+	this->conf_SA_temp_init_factor = best_point[1];
+	this->conf_SA_temp_factor_phase1 = best_point[2];
+	this->conf_SA_temp_factor_phase1_limit = best_point[3];
+	this->conf_SA_temp_factor_phase2 = best_point[4];
+	this->conf_SA_temp_factor_phase3 = best_point[5];
+
+	ftime(&tuning_end);
+
+	if (this->logMin()) {
+		cout << "Corblivar> Tuned SA parameters (configuration " << this->tuning_best << "):" << endl;
+		cout << "Corblivar>  Inner-loop operation-factor: " << this->conf_SA_loopFactor << endl;
+		cout << "Corblivar>  Start temperature-scaling factor: " << this->conf_SA_temp_init_factor << endl;
+		cout << "Corblivar>  Initial temperature-scaling factor for phase 1: " << this->conf_SA_temp_factor_phase1 << endl;
+		cout << "Corblivar>  Final temperature-scaling factor for phase 1: " << this->conf_SA_temp_factor_phase1_limit << endl;
+		cout << "Corblivar>  Temperature-scaling factor for phase 2: " << this->conf_SA_temp_factor_phase2 << endl;
+		cout << "Corblivar>  Temperature-scaling factor for phase 3: " << this->conf_SA_temp_factor_phase3 << endl;
+		cout << "Corblivar>  Avg objective: " << this->tuning_configs[this->tuning_best].avg_objective;
+		cout << " (configured parameters: " << this->tuning_configs[0].avg_objective << ")" << endl;
+		cout << "Corblivar>  Tuning runtime: " << (1000.0 * (tuning_end.time - tuning_start.time) + (tuning_end.millitm - tuning_start.millitm)) / 1000.0 << " s" << endl;
+		cout << endl;
+	}
+
+	// generate config file w/ tuned parameters
+	IO::writeTunedConfig(*this);
+
+	if (FloorPlanner::DBG_CALLS_SA) {
+		cout << "<- FloorPlanner::tuneSAParameters" << endl;
+	}
+}
+
+// one SA run for the given configuration and benchmark; the best solution is
+// reevaluated w/ all cost terms and the final thermal resolution
+void FloorPlanner::performTuningRun(TuningRun& run, FloorPlanner const& benchmark) const {
+	FloorPlanner fp(benchmark);
+	CorblivarCore corb(fp.conf_layers, fp.blocks.size());
+	TuningPoint const& point = this->tuning_configs[run.config].point;
+	struct timeb run_start, run_end;
+
+	// runs shall not log
+	fp.conf_log = 0;
+
+	fp.conf_SA_loopFactor = point[0];
+	fp.conf_SA_temp_init_factor = point[1];
+	fp.conf_SA_temp_factor_phase1 = point[2];
+	fp.conf_SA_temp_factor_phase1_limit = point[3];
+	fp.conf_SA_temp_factor_phase2 = point[4];
+	fp.conf_SA_temp_factor_phase3 = point[5];
+
+	// alignment requests are to refer to the run's blocks
+	IO::parseAlignmentRequests(fp, corb.editAlignments());
+
+	ftime(&run_start);
+
+	fp.initCorblivar(corb);
+	run.valid = fp.performSA(corb);
+
+	if (run.valid) {
+		corb.applyBestCBLs(false);
+		fp.generateLayout(corb, fp.conf_SA_opt_alignment);
+		run.cost = fp.evaluateLayout(corb.getAlignments(), 1.0, true, false, true);
+	}
+
+	ftime(&run_end);
+
+	run.runtime = (1000.0 * (run_end.time - run_start.time) + (run_end.millitm - run_start.millitm)) / 1000.0;
+}
+
+double FloorPlanner::evaluateTuningRun(TuningRun const& run, FloorPlanner const& benchmark, array<double, 5> const& reference) const {
+	array<double, 4> values, factors;
+	double objective;
+	unsigned i;
+
+	// cost term; only terms w/ non-zero reference are considered, other terms
+	// are already optimal for avg runs
+	if (run.valid) {
+
+		values = {{run.cost.HPWL_actual_value, static_cast<double>(run.cost.TSVs_actual_value),
+			run.cost.thermal_actual_value - benchmark.conf_power_blurring_parameters.temp_offset, run.cost.alignments_actual_value}};
+		factors = {{benchmark.conf_SA_cost_WL, benchmark.conf_SA_cost_TSVs, benchmark.conf_SA_cost_thermal, benchmark.conf_SA_cost_alignment}};
+
+		objective = 0.0;
+		for (i = 0; i < values.size(); i++) {
+			if (reference[i] > 0.0) {
+				objective += factors[i] * values[i] / reference[i];
+			}
+		}
+	}
+	else {
+		objective = FloorPlanner::TUNING_PENALTY_NON_FITTING;
+	}
+
+	// runtime term
+	if (reference[4] > 0.0) {
+		objective += this->tuning_runtime_weight * run.runtime / reference[4];
+	}
+
+	return objective;
+}
@@ -49,6 +49,10 @@ int main (int argc, char** argv) {
 	// init thermal analyzer, only reasonable after parsing config file
 	fp.initThermalAnalyzer();
 
+	// init thread pool; used for the grid-based thermal analysis which serves as
+	// reference for the power blurring
+	fp.initThreadPool();
+
 	// parse in solution file
 	IO::parseCorblivarFile(fp, corb);
 
@@ -58,4 +62,317 @@ int main (int argc, char** argv) {
 	// overall cost is not determined; cost cannot be determined since no
 	// normalization during SA search was performed
 	fp.finalize(corb, false);
+
+	// in-process fitting of power-blurring parameters, if requested
+	if (fp.fittingRequested()) {
+		fp.fitPowerBlurringParameters();
+	}
+}
+
+// in-process fitting of power-blurring parameters; the thermal map of the grid-based
+// thermal analysis serves as reference, similar to the HotSpot results for the
+// Octave-based fitting in thermal_analysis_octave/
+void FloorPlanner::fitPowerBlurringParameters() {
+	vector<FittingPoint> points;
+	vector<double> errors;
+	FittingPoint start_point;
+	unsigned best;
+	double temp_offset, mean_abs_error;
+	ThermalAnalyzer analyzer;
+	vector<TSV_Group> TSVs;
+	vector<Net> nets;
+	struct timeb fitting_start, fitting_end;
+
+	if (FloorPlanner::DBG_CALLS_SA) {
+		cout << "-> FloorPlanner::fitPowerBlurringParameters()" << endl;
+	}
+
+	// sanity check; the grid-based thermal analysis is required as reference
+	if (this->thermalSolver.thermal_maps.empty()) {
+		cout << "Corblivar> Fitting of power-blurring parameters requires the grid-based thermal analysis; activate it in the config file!" << endl;
+		return;
+	}
+
+	// reference; thermal map of lowest layer
+	vector< vector<double> > const& reference = this->thermalSolver.thermal_maps[0];
+
+	ftime(&fitting_start);
+
+	if (this->logMin()) {
+		cout << "Corblivar> Fitting power-blurring parameters against grid-based thermal analysis ..." << endl;
+		cout << "Corblivar>  Nelder-Mead searches: " << FloorPlanner::FITTING_STARTS << ", iterations limit: " << this->fitting_iterations << endl;
+	}
+
+	// starting points; the first one refers to the configured parameters, the
+	// others are randomly drawn around them. Points are determined beforehand
+	// in order to retain the sequential use of the random-number generator
+	start_point[0] = this->conf_power_blurring_parameters.impulse_factor;
+	start_point[1] = this->conf_power_blurring_parameters.impulse_factor_scaling_exponent;
+	start_point[2] = this->conf_power_blurring_parameters.mask_boundary_value;
+	start_point[3] = this->conf_power_blurring_parameters.power_density_scaling_padding_zone;
+	start_point[4] = this->conf_power_blurring_parameters.power_density_scaling_TSV_region;
+
+	points.push_back(start_point);
+	for (unsigned s = 1; s < FloorPlanner::FITTING_STARTS; s++) {
+		FittingPoint point;
+
+		point[0] = start_point[0] * Math::randF(0.5, 2.0);
+		point[1] = start_point[1] * Math::randF(0.5, 2.0);
+		// mask boundary value has to be below impulse factor
+		point[2] = point[0] * Math::randF(0.01, 0.5);
+		point[3] = Math::randF(1.0, FloorPlanner::FITTING_PDPZ_MAX);
+		point[4] = Math::randF(0.1, 1.0);
+
+		points.push_back(point);
+	}
+	errors.resize(points.size());
+
+	// parallel searches; each search operates on its own copies of the thermal
+	// analyzer, the TSVs, and the nets, where the latter two are required due
+	// to their mutable members
+	function<void(unsigned const&)> search = [&](unsigned const& s) {
+		ThermalAnalyzer search_analyzer = this->thermalAnalyzer;
+		vector<TSV_Group> search_TSVs = this->TSVs;
+		vector<Net> search_nets = this->nets;
+
+		this->fittingNelderMead(points[s], errors[s], search_analyzer, search_TSVs, search_nets, reference);
+	};
+
+	if (this->thread_pool) {
+		this->thread_pool->run(points.size(), search);
+	}
+	else {
+		for (unsigned s = 0; s < points.size(); s++) {
+			search(s);
+		}
+	}
+
+	// determine best result
+	best = 0;
+	for (unsigned s = 0; s < points.size(); s++) {
+
+		if (this->logMed()) {
+			cout << "Corblivar>  Search " << s << "; mean squared error [K^2]: " << errors[s] << endl;
+		}
+
+		if (errors[s] < errors[best]) {
+			best = s;
+		}
+	}
+
+	// apply best parameters; also determine related thermal map
+	analyzer = this->thermalAnalyzer;
+	TSVs = this->TSVs;
+	nets = this->nets;
+	this->evaluateFitting(points[best], analyzer, TSVs, nets, reference, &temp_offset, &mean_abs_error);
+	this->conf_power_blurring_parameters = this->fittingParameters(points[best]);
+	this->conf_power_blurring_parameters.temp_offset = temp_offset;
+
+	ftime(&fitting_end);
+
+	if (this->logMin()) {
+		cout << "Corblivar> Fitted power-blurring parameters:" << endl;
+		cout << "Corblivar>  Impulse factor: " << this->conf_power_blurring_parameters.impulse_factor << endl;
+		cout << "Corblivar>  Impulse-scaling factor: " << this->conf_power_blurring_parameters.impulse_factor_scaling_exponent << endl;
+		cout << "Corblivar>  Mask-boundary value: " << this->conf_power_blurring_parameters.mask_boundary_value << endl;
+		cout << "Corblivar>  Power-density scaling factor in padding zone: " << this->conf_power_blurring_parameters.power_density_scaling_padding_zone << endl;
+		cout << "Corblivar>  Power-density down-scaling factor for TSV regions: " << this->conf_power_blurring_parameters.power_density_scaling_TSV_region << endl;
+		cout << "Corblivar>  Temperature offset [K]: " << this->conf_power_blurring_parameters.temp_offset << endl;
+		cout << "Corblivar>  Mean squared error [K^2]: " << errors[best] << endl;
+		cout << "Corblivar>  Mean absolute error [K]: " << mean_abs_error << endl;
+		cout << "Corblivar>  Fitting runtime: " << (1000.0 * (fitting_end.time - fitting_start.time) + (fitting_end.millitm - fitting_start.millitm)) / 1000.0 << " s" << endl;
+		cout << endl;
+	}
+
+	// generate config file w/ fitted parameters
+	IO::writeFittedConfig(*this);
+
+	if (FloorPlanner::DBG_CALLS_SA) {
+		cout << "<- FloorPlanner::fitPowerBlurringParameters" << endl;
+	}
+}
+
+// Nelder-Mead search, starting from and returning point; simplex vertices are kept
+// sorted by their error
+void FloorPlanner::fittingNelderMead(FittingPoint& point, double& error, ThermalAnalyzer& analyzer, vector<TSV_Group>& TSVs, vector<Net>& nets,
+		vector< vector<double> > const& reference) const {
+	vector< pair<double, FittingPoint> > simplex;
+	FittingPoint centroid, reflected, candidate;
+	double error_reflected, error_candidate;
+	int iteration;
+	int i, p;
+
+	// initial simplex; vary each parameter separately, such that the vertices
+	// remain feasible if possible
+	simplex.emplace_back(this->evaluateFitting(point, analyzer, TSVs, nets, reference), point);
+	for (p = 0; p < FloorPlanner::FITTING_PARAMETERS; p++) {
+
+		candidate = point;
+		candidate[p] *= 1.2;
+		error_candidate = this->evaluateFitting(candidate, analyzer, TSVs, nets, reference);
+
+		if (error_candidate == numeric_limits<double>::max()) {
+			candidate[p] = point[p] * 0.8;
+			error_candidate = this->evaluateFitting(candidate, analyzer, TSVs, nets, reference);
+		}
+
+		simplex.emplace_back(error_candidate, candidate);
+	}
+
+	for (iteration = 0; iteration < this->fitting_iterations; iteration++) {
+
+		sort(simplex.begin(), simplex.end(),
+				[](pair<double, FittingPoint> const& a, pair<double, FittingPoint> const& b) {
+					return a.first < b.first;
+				});
+
+		pair<double, FittingPoint>& best = simplex.front();
+		pair<double, FittingPoint>& worst = simplex.back();
+		pair<double, FittingPoint> const& second_worst = simplex[simplex.size() - 2];
+
+		// convergence; error not further reduced within simplex
+		if (worst.first - best.first <= FloorPlanner::FITTING_TOLERANCE * best.first) {
+			break;
+		}
+
+		// centroid of all vertices but the worst
+		centroid.fill(0.0);
+		for (i = 0; i < static_cast<int>(simplex.size()) - 1; i++) {
+			for (p = 0; p < FloorPlanner::FITTING_PARAMETERS; p++) {
+				centroid[p] += simplex[i].second[p] / FloorPlanner::FITTING_PARAMETERS;
+			}
+		}
+
+		// reflection
+		for (p = 0; p < FloorPlanner::FITTING_PARAMETERS; p++) {
+			reflected[p] = 2.0 * centroid[p] - worst.second[p];
+		}
+		error_reflected = this->evaluateFitting(reflected, analyzer, TSVs, nets, reference);
+
+		// reflected point is new best; try expansion
+		if (error_reflected < best.first) {
+
+			for (p = 0; p < FloorPlanner::FITTING_PARAMETERS; p++) {
+				candidate[p] = 3.0 * centroid[p] - 2.0 * worst.second[p];
+			}
+			error_candidate = this->evaluateFitting(candidate, analyzer, TSVs, nets, reference);
+
+			if (error_candidate < error_reflected) {
+				worst = {error_candidate, candidate};
+			}
+			else {
+				worst = {error_reflected, reflected};
+			}
+		}
+		// reflected point is better than second worst; accept
+		else if (error_reflected < second_worst.first) {
+			worst = {error_reflected, reflected};
+		}
+		// contraction, outside or inside of the simplex
+		else {
+			for (p = 0; p < FloorPlanner::FITTING_PARAMETERS; p++) {
+				if (error_reflected < worst.first) {
+					candidate[p] = 0.5 * (centroid[p] + reflected[p]);
+				}
+				else {
+					candidate[p] = 0.5 * (centroid[p] + worst.second[p]);
+				}
+			}
+			error_candidate = this->evaluateFitting(candidate, analyzer, TSVs, nets, reference);
+
+			if (error_candidate < min(error_reflected, worst.first)) {
+				worst = {error_candidate, candidate};
+			}
+			// shrink simplex towards best vertex
+			else {
+				for (i = 1; i < static_cast<int>(simplex.size()); i++) {
+					for (p = 0; p < FloorPlanner::FITTING_PARAMETERS; p++) {
+						simplex[i].second[p] = 0.5 * (best.second[p] + simplex[i].second[p]);
+					}
+					simplex[i].first = this->evaluateFitting(simplex[i].second, analyzer, TSVs, nets, reference);
+				}
+			}
+		}
+	}
+
+	// return best vertex
+	sort(simplex.begin(), simplex.end(),
+			[](pair<double, FittingPoint> const& a, pair<double, FittingPoint> const& b) {
+				return a.first < b.first;
+			});
+	point = simplex.front().second;
+	error = simplex.front().first;
+}
+
+ThermalAnalyzer::MaskParameters FloorPlanner::fittingParameters(FittingPoint const& point) const {
+	ThermalAnalyzer::MaskParameters parameters = this->conf_power_blurring_parameters;
+
+	parameters.impulse_factor = point[0];
+	parameters.impulse_factor_scaling_exponent = point[1];
+	parameters.mask_boundary_value = point[2];
+	parameters.power_density_scaling_padding_zone = point[3];
+	parameters.power_density_scaling_TSV_region = point[4];
+
+	// the temperature offset is only added to the thermal map; it is fitted
+	// separately, see evaluateFitting
+	parameters.temp_offset = 0.0;
+
+	return parameters;
+}
+
+double FloorPlanner::evaluateFitting(FittingPoint const& point, ThermalAnalyzer& analyzer, vector<TSV_Group>& TSVs, vector<Net>& nets,
+		vector< vector<double> > const& reference, double* temp_offset, double* mean_abs_error) const {
+	ThermalAnalyzer::MaskParameters parameters;
+	ThermalAnalyzer::Temp temp;
+	double error, abs_error, diff, offset, bins;
+	int x, y;
+
+	// feasibility of parameters, see also thermal_analysis_octave/optimization.m
+	if (!(point[0] > 0.0 && point[1] > 0.0 && point[2] > 0.0 && point[2] < point[0]
+				&& point[3] >= 1.0 && point[3] <= FloorPlanner::FITTING_PDPZ_MAX
+				&& point[4] > 0.0 && point[4] <= 1.0)) {
+		return numeric_limits<double>::max();
+	}
+
+	parameters = this->fittingParameters(point);
+
+	// thermal analysis, similar to evaluateThermalDistr
+	analyzer.initThermalMasks(this->conf_layers, false, parameters, this->conf_power_blurring_TSV_density_masks);
+	analyzer.generatePowerMaps(this->conf_layers, this->blocks, this->getOutline(), parameters);
+	analyzer.adaptPowerMaps(this->conf_layers, TSVs, nets, parameters);
+	analyzer.performPowerBlurring(temp, this->conf_layers, parameters);
+
+	vector< vector<double> > const& thermal_map = analyzer.getThermalMap();
+	bins = pow(analyzer.getThermalMapDim(), 2);
+
+	// temperature offset; the thermal map is blurred w/o offset, thus the
+	// offset minimizing the squared error is the mean difference to the
+	// reference; limited to non-negative values, as required for the config
+	offset = 0.0;
+	for (x = 0; x < analyzer.getThermalMapDim(); x++) {
+		for (y = 0; y < analyzer.getThermalMapDim(); y++) {
+			offset += reference[x][y] - thermal_map[x][y];
+		}
+	}
+	offset = max(0.0, offset / bins);
+
+	// compare thermal maps
+	error = abs_error = 0.0;
+	for (x = 0; x < analyzer.getThermalMapDim(); x++) {
+		for (y = 0; y < analyzer.getThermalMapDim(); y++) {
+			diff = thermal_map[x][y] + offset - reference[x][y];
+			error += diff * diff;
+			abs_error += abs(diff);
+		}
+	}
+	error /= bins;
+
+	if (temp_offset != nullptr) {
+		*temp_offset = offset;
+	}
+	if (mean_abs_error != nullptr) {
+		*mean_abs_error = abs_error / bins;
+	}
+
+	return error;
 }